@@ -235,7 +235,9 @@ void CollisionManager::AddStructToNameContainer(UEStruct Struct, bool bIsStruct)
 
 	auto AddToContainerAndTranslationMap = [&](auto Member, ECollisionType CollisionType, bool bIsStruct, UEFunction Func = nullptr) -> void
 	{
-		const uint64 Index = AddNameToContainer(StructNames, Struct, MemberNames.FindOrAdd(Member.GetValidName()), CollisionType, bIsStruct, Func);
+		const std::string_view ValidName = Member.GetValidNameView();
+
+		const uint64 Index = AddNameToContainer(StructNames, Struct, MemberNames.FindOrAdd(ValidName.data(), static_cast<int32>(ValidName.size())), CollisionType, bIsStruct, Func);
 
 		const auto [It, bInserted] = TranslationMap.emplace(KeyFunctions::GetKeyForCollisionInfo(Struct, Member), Index);
 		
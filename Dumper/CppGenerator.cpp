@@ -1,6 +1,8 @@
 #include <vector>
 
 #include <array>
+#include <thread>
+#include <atomic>
 
 #include "CppGenerator.h"
 #include "ObjectArray.h"
@@ -559,8 +561,9 @@ std::string CppGenerator::GenerateFunctions(const StructWrapper& Struct, const M
 {
 	namespace CppSettings = Settings::CppGenerator;
 
-	static PredefinedFunction StaticClass;
-	static PredefinedFunction GetDefaultObj;
+	/* thread_local, the Body/ReturnType is modified for every class and packages are generated on multiple threads */
+	thread_local PredefinedFunction StaticClass;
+	thread_local PredefinedFunction GetDefaultObj;
 
 	if (StaticClass.NameWithParams.empty())
 		StaticClass = {
@@ -636,10 +639,7 @@ std::string CppGenerator::GenerateFunctions(const StructWrapper& Struct, const M
 	std::string NameText = CppSettings::XORString ? std::format("{}(\"{}\")", CppSettings::XORString, Name) : std::format("\"{}\"", Name);
 	
 
-	static UEClass BPGeneratedClass = nullptr;
-	
-	if (BPGeneratedClass == nullptr)
-		BPGeneratedClass = ObjectArray::FindClassFast("BlueprintGeneratedClass");
+	static const UEClass BPGeneratedClass = ObjectArray::FindClassFast("BlueprintGeneratedClass");
 
 
 	const char* StaticClassImplFunctionName = "StaticClassImpl";
@@ -672,9 +672,8 @@ R"({{
 }})", StructName);
 
 
-	std::shared_ptr<StructWrapper> CurrentStructPtr = std::make_shared<StructWrapper>(Struct);
-	InHeaderFunctionText += GenerateSingleFunction(FunctionWrapper(CurrentStructPtr, &StaticClass), StructName, FunctionFile, ParamFile);
-	InHeaderFunctionText += GenerateSingleFunction(FunctionWrapper(CurrentStructPtr, &GetDefaultObj), StructName, FunctionFile, ParamFile);
+	InHeaderFunctionText += GenerateSingleFunction(FunctionWrapper(&Struct, &StaticClass), StructName, FunctionFile, ParamFile);
+	InHeaderFunctionText += GenerateSingleFunction(FunctionWrapper(&Struct, &GetDefaultObj), StructName, FunctionFile, ParamFile);
 
 	return InHeaderFunctionText;
 }
@@ -873,14 +872,8 @@ std::string CppGenerator::GetEnumUnderlayingType(const EnumWrapper& Enum)
 
 std::string CppGenerator::GetCycleFixupType(const StructWrapper& Struct, bool bIsForInheritance)
 {
-	static int32 UObjectSize = 0x0;
-	static int32 AActorSize = 0x0;
-
-	if (UObjectSize == 0x0 || AActorSize == 0x0)
-	{
-		UObjectSize = StructWrapper(ObjectArray::FindClassFast("Object")).GetSize();
-		AActorSize = StructWrapper(ObjectArray::FindClassFast("Actor")).GetSize();
-	}
+	static const int32 UObjectSize = StructWrapper(ObjectArray::FindClassFast("Object")).GetSize();
+	static const int32 AActorSize = StructWrapper(ObjectArray::FindClassFast("Actor")).GetSize();
 
 	/* Predefined structs can not be cyclic, unless you did something horribly wrong when defining the predefined struct! */
 	if (!Struct.IsUnrealStruct())
@@ -933,7 +926,12 @@ std::string CppGenerator::GetMemberTypeString(UEProperty Member, int32 PackageIn
 	return GetMemberTypeStringWithoutConst(Member, PackageIndex);
 }
 
-std::string CppGenerator::GetMemberTypeStringWithoutConst(UEProperty Member, int32 PackageIndex)
+const std::string& CppGenerator::GetMemberTypeStringWithoutConst(UEProperty Member, int32 PackageIndex)
+{
+	return MemberTypeStrings.FindOrAdd(Member, PackageIndex, [Member, PackageIndex]() -> std::string { return CreateMemberTypeStringWithoutConst(Member, PackageIndex); });
+}
+
+std::string CppGenerator::CreateMemberTypeStringWithoutConst(UEProperty Member, int32 PackageIndex)
 {
 	auto [Class, FieldClass] = Member.GetClass();
 
@@ -1315,7 +1313,7 @@ void CppGenerator::GenerateDebugAssertions(StreamType& AssertionStream)
 
 	for (PackageInfoHandle Package : PackageManager::IterateOverPackageInfos())
 	{
-		DependencyManager::OnVisitCallbackType GenerateStructAssertionsCallback = [&AssertionStream](int32 Index) -> void
+		auto GenerateStructAssertionsCallback = [&AssertionStream](int32 Index) -> void
 		{
 			StructWrapper Struct = ObjectArray::GetByIndex<UEStruct>(Index);
 
@@ -1517,146 +1515,234 @@ void CppGenerator::WriteFileEnd(StreamType& File, EFileType Type)
 
 void CppGenerator::Generate()
 {
-	// Generate SDK.hpp with sorted packages
-	StreamType SdkHpp(MainFolder / "SDK.hpp");
-	GenerateSDKHeader(SdkHpp);
+	static_assert(!Settings::CppGenerator::bOnlyGenerateChangedPackages || Settings::Generator::bOnlyWriteChangedFiles, "bOnlyGenerateChangedPackages requires the output of the previous run, enable bOnlyWriteChangedFiles!");
 
-	// Generate PropertyFixup.hpp
-	StreamType PropertyFixup(MainFolder / "PropertyFixup.hpp");
-	GeneratePropertyFixupFile(PropertyFixup);
+	IncrementalFileWriter::Begin(MainFolder);
 
-	// Generate NameCollisions.inl file containing forward declarations for classes in namespaces (potentially requires lock)
-	StreamType NameCollisionsInl(MainFolder / "NameCollisions.inl");
-	GenerateNameCollisionsInl(NameCollisionsInl);
+	if constexpr (Settings::CppGenerator::bOnlyGenerateChangedPackages)
+		PackageDiff::Begin(MainFolder);
 
-	// Generate UnrealContainers.hpp
-	StreamType UnrealContainers(MainFolder / "UnrealContainers.hpp");
-	GenerateUnrealContainers(UnrealContainers);
+	MemberTypeStrings.Clear();
 
-	// Generate Basic.hpp and Basic.cpp files
-	StreamType BasicHpp(Subfolder / "Basic.hpp");
-	StreamType BasicCpp(Subfolder / "Basic.cpp");
-	GenerateBasicFiles(BasicHpp, BasicCpp);
+	/* Files are written once their stream goes out of scope */
+	{
+		// Generate SDK.hpp with sorted packages
+		StreamType SdkHpp(MainFolder / "SDK.hpp");
+		GenerateSDKHeader(SdkHpp);
 
+		// Generate PropertyFixup.hpp
+		StreamType PropertyFixup(MainFolder / "PropertyFixup.hpp");
+		GeneratePropertyFixupFile(PropertyFixup);
 
-	if constexpr (Settings::Debug::bGenerateAssertionFile)
-	{
-		// Generate Assertions.inl file containing assertions on struct-size, struct-align and member offsets
-		StreamType DebugAssertions(MainFolder / "Assertions.inl");
-		GenerateDebugAssertions(DebugAssertions);
+		// Generate NameCollisions.inl file containing forward declarations for classes in namespaces (potentially requires lock)
+		StreamType NameCollisionsInl(MainFolder / "NameCollisions.inl");
+		GenerateNameCollisionsInl(NameCollisionsInl);
+
+		// Generate UnrealContainers.hpp
+		StreamType UnrealContainers(MainFolder / "UnrealContainers.hpp");
+		GenerateUnrealContainers(UnrealContainers);
+
+		// Generate Basic.hpp and Basic.cpp files
+		StreamType BasicHpp(Subfolder / "Basic.hpp");
+		StreamType BasicCpp(Subfolder / "Basic.cpp");
+		GenerateBasicFiles(BasicHpp, BasicCpp);
+
+
+		if constexpr (Settings::Debug::bGenerateAssertionFile)
+		{
+			// Generate Assertions.inl file containing assertions on struct-size, struct-align and member offsets
+			StreamType DebugAssertions(MainFolder / "Assertions.inl");
+			GenerateDebugAssertions(DebugAssertions);
+		}
 	}
 
 	// Generates all packages and writes them to files
+	std::vector<PackageInfoHandle> Packages;
+	Packages.reserve(PackageManager::GetPackageInfos().size());
+
 	for (PackageInfoHandle Package : PackageManager::IterateOverPackageInfos())
 	{
 		if (Package.IsEmpty())
 			continue;
 
-		const std::string FileName = Settings::CppGenerator::FilePrefix + Package.GetName();
-		const std::u8string U8FileName = reinterpret_cast<const std::u8string&>(FileName);
+		if constexpr (Settings::CppGenerator::bOnlyGenerateChangedPackages)
+		{
+			/* Unchanged packages keep their files, unless they were deleted since the previous run */
+			if (!PackageDiff::ShouldRegeneratePackage(Package.GetIndex()) && KeepPackageFiles(Package))
+				continue;
+		}
 
-		StreamType ClassesFile;
-		StreamType StructsFile;
-		StreamType ParametersFile;
-		StreamType FunctionsFile;
+		Packages.push_back(Package);
+	}
 
-		/* Create files and handles namespaces and includes */
-		if (Package.HasClasses())
-		{
-			ClassesFile = StreamType(Subfolder / (U8FileName + u8"_classes.hpp"));
+	/* Every package writes to its own files, so packages can be generated independently. Threads pick the next unprocessed package once they're done. */
+	std::atomic<size_t> NextPackageIndex = 0x0;
 
-			if (!ClassesFile.is_open())
-				std::cout << "Error opening file \"" << (FileName + "_classes.hpp") << "\"" << std::endl;
+	auto GeneratePackagesWorker = [&Packages, &NextPackageIndex]() -> void
+	{
+		/* The predefined-member lookup is thread_local */
+		MemberManager::SetPredefinedMemberLookupPtr(&PredefinedMembers);
 
-			WriteFileHead(ClassesFile, Package, EFileType::Classes);
+		for (size_t i = NextPackageIndex++; i < Packages.size(); i = NextPackageIndex++)
+			GeneratePackage(Packages[i]);
+	};
 
-			/* Write enum foward declarations before all of the classes */
-			GenerateEnumFwdDeclarations(ClassesFile, Package, true);
-		}
+	uint32 NumThreads = Settings::CppGenerator::NumPackageGenerationThreads > 0 ? Settings::CppGenerator::NumPackageGenerationThreads : std::thread::hardware_concurrency();
 
-		if (Package.HasStructs() || Package.HasEnums())
-		{
-			StructsFile = StreamType(Subfolder / (U8FileName + u8"_structs.hpp"));
+	if (NumThreads > Packages.size())
+		NumThreads = static_cast<uint32>(Packages.size());
 
-			if (!StructsFile.is_open())
-				std::cout << "Error opening file \"" << (FileName + "_structs.hpp") << "\"" << std::endl;
+	std::vector<std::thread> Workers;
 
-			WriteFileHead(StructsFile, Package, EFileType::Structs);
+	/* The calling thread acts as a worker too */
+	for (uint32 i = 1; i < NumThreads; i++)
+		Workers.emplace_back(GeneratePackagesWorker);
 
-			/* Write enum foward declarations before all of the structs */
-			GenerateEnumFwdDeclarations(StructsFile, Package, false);
-		}
+	GeneratePackagesWorker();
 
-		if (Package.HasParameterStructs())
-		{
-			ParametersFile = StreamType(Subfolder / (U8FileName + u8"_parameters.hpp"));
+	for (std::thread& Worker : Workers)
+		Worker.join();
 
-			if (!ParametersFile.is_open())
-				std::cout << "Error opening file \"" << (FileName + "_parameters.hpp") << "\"" << std::endl;
+	if constexpr (Settings::Debug::bPrintPropertyTypeCacheStats)
+		std::cout << std::format("Built {} unique member-types, {} type-strings were reused.\n", MemberTypeStrings.GetNumMisses(), MemberTypeStrings.GetNumHits()) << std::endl;
 
-			WriteFileHead(ParametersFile, Package, EFileType::Parameters);
-		}
+	if constexpr (Settings::CppGenerator::bOnlyGenerateChangedPackages)
+		PackageDiff::End();
 
-		if (Package.HasFunctions())
-		{
-			FunctionsFile = StreamType(Subfolder / (U8FileName + u8"_functions.cpp"));
+	IncrementalFileWriter::End();
+}
 
-			if (!FunctionsFile.is_open())
-				std::cout << "Error opening file \"" << (FileName + "_functions.cpp") << "\"" << std::endl;
+bool CppGenerator::KeepPackageFiles(PackageInfoHandle Package)
+{
+	const std::string FileName = Settings::CppGenerator::FilePrefix + Package.GetName();
+	const std::u8string U8FileName = reinterpret_cast<const std::u8string&>(FileName);
 
-			WriteFileHead(FunctionsFile, Package, EFileType::Functions);
-		}
+	bool bKeptAllFiles = true;
 
-		const int32 PackageIndex = Package.GetIndex();
+	if (Package.HasClasses())
+		bKeptAllFiles = IncrementalFileWriter::KeepFile(Subfolder / (U8FileName + u8"_classes.hpp")) && bKeptAllFiles;
 
-		/* 
-		* Generate classes/structs/enums/functions directly into the respective files
-		* 
-		* Note: Some filestreams aren't opened but passed as parameters anyway because the function demands it, they are not used if they are closed
-		*/
-		for (int32 EnumIdx : Package.GetEnums())
-		{
-			GenerateEnum(ObjectArray::GetByIndex<UEEnum>(EnumIdx), StructsFile);
-		}
+	if (Package.HasStructs() || Package.HasEnums())
+		bKeptAllFiles = IncrementalFileWriter::KeepFile(Subfolder / (U8FileName + u8"_structs.hpp")) && bKeptAllFiles;
 
-		if (Package.HasStructs())
-		{
-			const DependencyManager& Structs = Package.GetSortedStructs();
+	if (Package.HasParameterStructs())
+		bKeptAllFiles = IncrementalFileWriter::KeepFile(Subfolder / (U8FileName + u8"_parameters.hpp")) && bKeptAllFiles;
 
-			DependencyManager::OnVisitCallbackType GenerateStructCallback = [&](int32 Index) -> void
-			{
-				GenerateStruct(ObjectArray::GetByIndex<UEStruct>(Index), StructsFile, FunctionsFile, ParametersFile, PackageIndex);
-			};
+	if (Package.HasFunctions())
+		bKeptAllFiles = IncrementalFileWriter::KeepFile(Subfolder / (U8FileName + u8"_functions.cpp")) && bKeptAllFiles;
 
-			Structs.VisitAllNodesWithCallback(GenerateStructCallback);
-		}
+	return bKeptAllFiles;
+}
 
-		if (Package.HasClasses())
-		{
-			const DependencyManager& Classes = Package.GetSortedClasses();
+void CppGenerator::GeneratePackage(PackageInfoHandle Package)
+{
+	if (Package.IsEmpty())
+		return;
 
-			DependencyManager::OnVisitCallbackType GenerateClassCallback = [&](int32 Index) -> void
-			{
-				GenerateStruct(ObjectArray::GetByIndex<UEStruct>(Index), ClassesFile, FunctionsFile, ParametersFile, PackageIndex);
-			};
+	const std::string FileName = Settings::CppGenerator::FilePrefix + Package.GetName();
+	const std::u8string U8FileName = reinterpret_cast<const std::u8string&>(FileName);
 
-			Classes.VisitAllNodesWithCallback(GenerateClassCallback);
-		}
+	StreamType ClassesFile;
+	StreamType StructsFile;
+	StreamType ParametersFile;
+	StreamType FunctionsFile;
 
+	/* Create files and handles namespaces and includes */
+	if (Package.HasClasses())
+	{
+		ClassesFile = StreamType(Subfolder / (U8FileName + u8"_classes.hpp"));
 
-		/* Closes any namespaces if required */
-		if (Package.HasClasses())
-			WriteFileEnd(ClassesFile, EFileType::Classes);
+		if (!ClassesFile.is_open())
+			std::cout << "Error opening file \"" << (FileName + "_classes.hpp") << "\"" << std::endl;
 
-		if (Package.HasStructs() || Package.HasEnums())
-			WriteFileEnd(StructsFile, EFileType::Structs);
+		WriteFileHead(ClassesFile, Package, EFileType::Classes);
 
-		if (Package.HasParameterStructs())
-			WriteFileEnd(ParametersFile, EFileType::Parameters);
+		/* Write enum foward declarations before all of the classes */
+		GenerateEnumFwdDeclarations(ClassesFile, Package, true);
+	}
+
+	if (Package.HasStructs() || Package.HasEnums())
+	{
+		StructsFile = StreamType(Subfolder / (U8FileName + u8"_structs.hpp"));
+
+		if (!StructsFile.is_open())
+			std::cout << "Error opening file \"" << (FileName + "_structs.hpp") << "\"" << std::endl;
+
+		WriteFileHead(StructsFile, Package, EFileType::Structs);
 
-		if (Package.HasFunctions())
-			WriteFileEnd(FunctionsFile, EFileType::Functions);
+		/* Write enum foward declarations before all of the structs */
+		GenerateEnumFwdDeclarations(StructsFile, Package, false);
 	}
+
+	if (Package.HasParameterStructs())
+	{
+		ParametersFile = StreamType(Subfolder / (U8FileName + u8"_parameters.hpp"));
+
+		if (!ParametersFile.is_open())
+			std::cout << "Error opening file \"" << (FileName + "_parameters.hpp") << "\"" << std::endl;
+
+		WriteFileHead(ParametersFile, Package, EFileType::Parameters);
+	}
+
+	if (Package.HasFunctions())
+	{
+		FunctionsFile = StreamType(Subfolder / (U8FileName + u8"_functions.cpp"));
+
+		if (!FunctionsFile.is_open())
+			std::cout << "Error opening file \"" << (FileName + "_functions.cpp") << "\"" << std::endl;
+
+		WriteFileHead(FunctionsFile, Package, EFileType::Functions);
+	}
+
+	const int32 PackageIndex = Package.GetIndex();
+
+	/* 
+	* Generate classes/structs/enums/functions directly into the respective files
+	* 
+	* Note: Some filestreams aren't opened but passed as parameters anyway because the function demands it, they are not used if they are closed
+	*/
+	for (int32 EnumIdx : Package.GetEnums())
+	{
+		GenerateEnum(ObjectArray::GetByIndex<UEEnum>(EnumIdx), StructsFile);
+	}
+
+	if (Package.HasStructs())
+	{
+		const DependencyManager& Structs = Package.GetSortedStructs();
+
+		auto GenerateStructCallback = [&](int32 Index) -> void
+		{
+			GenerateStruct(ObjectArray::GetByIndex<UEStruct>(Index), StructsFile, FunctionsFile, ParametersFile, PackageIndex);
+		};
+
+		Structs.VisitAllNodesWithCallback(GenerateStructCallback);
+	}
+
+	if (Package.HasClasses())
+	{
+		const DependencyManager& Classes = Package.GetSortedClasses();
+
+		auto GenerateClassCallback = [&](int32 Index) -> void
+		{
+			GenerateStruct(ObjectArray::GetByIndex<UEStruct>(Index), ClassesFile, FunctionsFile, ParametersFile, PackageIndex);
+		};
+
+		Classes.VisitAllNodesWithCallback(GenerateClassCallback);
+	}
+
+
+	/* Closes any namespaces if required */
+	if (Package.HasClasses())
+		WriteFileEnd(ClassesFile, EFileType::Classes);
+
+	if (Package.HasStructs() || Package.HasEnums())
+		WriteFileEnd(StructsFile, EFileType::Structs);
+
+	if (Package.HasParameterStructs())
+		WriteFileEnd(ParametersFile, EFileType::Parameters);
+
+	if (Package.HasFunctions())
+		WriteFileEnd(FunctionsFile, EFileType::Functions);
 }
 
 void CppGenerator::InitPredefinedMembers()
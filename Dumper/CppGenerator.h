@@ -10,6 +10,9 @@
 #include "PackageManager.h"
 
 #include "Generator.h"
+#include "IncrementalFileWriter.h"
+#include "PackageDiff.h"
+#include "PropertyTypeCache.h"
 
 #include <fstream>
 
@@ -21,6 +24,7 @@ class CppGenerator
 private:
     friend class CppGeneratorTest;
     friend class Generator;
+    friend class PackageDiff;
 
 private:
     struct ParamInfo
@@ -68,17 +72,23 @@ private:
     };
 
 private:
-    using StreamType = std::ofstream;
+    using StreamType = BufferedFileStream;
 
 public:
     static inline PredefinedMemberLookupMapType PredefinedMembers;
 
+    /* Type-strings of properties without 'const', shared between all structs, functions and package-generation threads */
+    static inline PropertyTypeCache<std::string> MemberTypeStrings;
+
     static inline std::string MainFolderName = "CppSDK";
     static inline std::string SubfolderName = "SDK";
 
     static inline fs::path MainFolder;
     static inline fs::path Subfolder;
 
+    /* Files are written through the IncrementalFileWriter, which compares against the previous output instead of it being moved to '_OLD' */
+    static constexpr bool bKeepPreviousOutput = Settings::Generator::bOnlyWriteChangedFiles;
+
 private:
     static inline std::vector<PredefinedStruct> PredefinedStructs;
 
@@ -104,7 +114,8 @@ private:
 private: /* utility functions */
     static std::string GetMemberTypeString(const PropertyWrapper& MemberWrapper, int32 PackageIndex = -1, bool bAllowForConstPtrMembers = false /* const USomeClass* Member; */);
     static std::string GetMemberTypeString(UEProperty Member, int32 PackageIndex = -1, bool bAllowForConstPtrMembers = false);
-    static std::string GetMemberTypeStringWithoutConst(UEProperty Member, int32 PackageIndex = -1);
+    static const std::string& GetMemberTypeStringWithoutConst(UEProperty Member, int32 PackageIndex = -1);
+    static std::string CreateMemberTypeStringWithoutConst(UEProperty Member, int32 PackageIndex);
 
     static std::string GetFunctionSignature(UEFunction Func);
 
@@ -138,6 +149,13 @@ private:
     */
     static void GenerateUnrealContainers(StreamType& UEContainersHeader);
 
+private:
+    /* Generates the _classes, _structs, _parameters and _functions files of a single package. Called from multiple threads concurrently. */
+    static void GeneratePackage(PackageInfoHandle Package);
+
+    /* Keeps all files of this package from the previous run, returns false if any of them is missing */
+    static bool KeepPackageFiles(PackageInfoHandle Package);
+
 public:
     static void Generate();
 
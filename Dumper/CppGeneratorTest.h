@@ -58,12 +58,12 @@ private:
 		}
 	};
 
-	static inline std::ofstream ClassFile;
-	static inline std::ofstream StructFile;
-	static inline std::ofstream FunctionFile;
-	static inline std::ofstream ParamFile;
+	static inline CppGenerator::StreamType ClassFile;
+	static inline CppGenerator::StreamType StructFile;
+	static inline CppGenerator::StreamType FunctionFile;
+	static inline CppGenerator::StreamType ParamFile;
 
-	static inline std::ofstream NameCollisionInl;
+	static inline CppGenerator::StreamType NameCollisionInl;
 
 private:
 	static void InitTestVariables()
@@ -82,12 +82,12 @@ private:
 
 		fs::path BasePath("C:/Users/savek/Documents/GitHub/Fortnite-Dumper-7/SDKTest");
 
-		ClassFile = std::ofstream(BasePath / "CPP_classes.hpp", std::ios::trunc);
-		StructFile = std::ofstream(BasePath / "CPP_structs.hpp", std::ios::trunc);
-		FunctionFile = std::ofstream(BasePath / "CPP_functions.cpp", std::ios::trunc);
-		ParamFile = std::ofstream(BasePath / "CPP_params.hpp", std::ios::trunc);
+		ClassFile = CppGenerator::StreamType(BasePath / "CPP_classes.hpp");
+		StructFile = CppGenerator::StreamType(BasePath / "CPP_structs.hpp");
+		FunctionFile = CppGenerator::StreamType(BasePath / "CPP_functions.cpp");
+		ParamFile = CppGenerator::StreamType(BasePath / "CPP_params.hpp");
 
-		NameCollisionInl = std::ofstream(BasePath / "NameCollision.inl", std::ios::trunc);
+		NameCollisionInl = CppGenerator::StreamType(BasePath / "NameCollision.inl");
 
 		bDidInit = true;
 	}
@@ -9,53 +9,62 @@ DependencyManager::DependencyManager(int32 ObjectToTrack)
 void DependencyManager::SetExists(const int32 DepedantIdx)
 {
 	AllDependencies[DepedantIdx];
+	bIsGraphOutdated = true;
 }
 
 void DependencyManager::AddDependency(const int32 DepedantIdx, int32 DependencyIndex)
 {
 	AllDependencies[DepedantIdx].DependencyIndices.insert(DependencyIndex);
+	bIsGraphOutdated = true;
 }
 
 void DependencyManager::SetDependencies(const int32 DepedantIdx, std::unordered_set<int32>&& Dependencies)
 {
 	AllDependencies[DepedantIdx].DependencyIndices = std::move(Dependencies);
+	bIsGraphOutdated = true;
 }
 
-size_t DependencyManager::GetNumEntries() const
-{
-	return AllDependencies.size();
-}
-
-void DependencyManager::VisitIndexAndDependencies(int32 Index, OnVisitCallbackType Callback) const
+DependencyManager::DependencyGraph DependencyManager::CreateGraph() const
 {
-	auto& [IterationHitCounter, Dependencies] = AllDependencies.at(Index);
+	DependencyGraph NewGraph;
+	NewGraph.NodeIndices.reserve(AllDependencies.size());
+	NewGraph.EdgeOffsets.reserve(AllDependencies.size() + 1);
 
-	if (IterationHitCounter >= CurrentIterationHitCount)
-		return;
+	std::unordered_map<int32, int32>& ObjectIndexToNode = NewGraph.ObjectIndexToNode;
+	ObjectIndexToNode.reserve(AllDependencies.size());
 
-	IterationHitCounter = CurrentIterationHitCount;
+	for (const auto& [Index, DependencyInfo] : AllDependencies)
+	{
+		ObjectIndexToNode[Index] = static_cast<int32>(NewGraph.NodeIndices.size());
+		NewGraph.NodeIndices.push_back(Index);
+	}
 
-	for (int32 Dependency : Dependencies)
+	for (const auto& [Index, DependencyInfo] : AllDependencies)
 	{
-		VisitIndexAndDependencies(Dependency, Callback);
+		NewGraph.EdgeOffsets.push_back(static_cast<int32>(NewGraph.Edges.size()));
+
+		for (int32 Dependency : DependencyInfo.DependencyIndices)
+		{
+			auto It = ObjectIndexToNode.find(Dependency);
+
+			/* Dependencies which aren't tracked by this DependencyManager can't be visited */
+			if (It != ObjectIndexToNode.end())
+				NewGraph.Edges.push_back(It->second);
+		}
 	}
 
-	Callback(Index);
+	NewGraph.EdgeOffsets.push_back(static_cast<int32>(NewGraph.Edges.size()));
+
+	return NewGraph;
 }
 
-void DependencyManager::VisitIndexAndDependenciesWithCallback(int32 Index, OnVisitCallbackType Callback) const
+void DependencyManager::BuildGraph()
 {
-	CurrentIterationHitCount++;
-
-	VisitIndexAndDependencies(Index, Callback);
+	Graph = CreateGraph();
+	bIsGraphOutdated = false;
 }
 
-void DependencyManager::VisitAllNodesWithCallback(OnVisitCallbackType Callback) const
+size_t DependencyManager::GetNumEntries() const
 {
-	CurrentIterationHitCount++;
-
-	for (const auto& [Index, DependencyInfo] : AllDependencies)
-	{
-		VisitIndexAndDependencies(Index, Callback);
-	}
+	return AllDependencies.size();
 }
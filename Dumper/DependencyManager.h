@@ -1,34 +1,48 @@
 #pragma once
 #include <unordered_set>
 #include <unordered_map>
+#include <vector>
 #include <iostream>
 #include <format>
-#include <functional>
 
 #include "Enums.h"
 
 
 class DependencyManager
 {
-public:
-	using OnVisitCallbackType = std::function<void(int32 Index)>;
-
 private:
 	struct IndexDependencyInfo
 	{
-		/* Counter incremented every time this element is hit during iteration, **if** the counter is less than the CurrentIterationIndex */
-		mutable uint64 IterationHitCounter = 0x0;
-
 		/* Indices of Objects required by this Object */
 		std::unordered_set<int32> DependencyIndices;
 	};
 
+	/* 
+	* Compressed-sparse-row representation of 'AllDependencies'. Nodes and edges are stored in the iteration order of the maps/sets they were
+	* built from, so visiting the graph yields the exact same order as visiting the maps did.
+	*/
+	struct DependencyGraph
+	{
+		/* Object-index of every node */
+		std::vector<int32> NodeIndices;
+
+		/* Edges of node 'i' are Edges[EdgeOffsets[i]] to Edges[EdgeOffsets[i + 1] - 1] */
+		std::vector<int32> EdgeOffsets;
+
+		/* Node-indices, not object-indices, of the dependencies */
+		std::vector<int32> Edges;
+
+		/* Object-index -> node-index */
+		std::unordered_map<int32, int32> ObjectIndexToNode;
+	};
+
 private:
 	/* List of Objects and their Dependencies */
 	std::unordered_map<int32, IndexDependencyInfo> AllDependencies;
 
-	/* Count to track how often the Dependency-List was iterated. Allows for up to 2^64 iterations of this list. */
-	mutable uint64 CurrentIterationHitCount = 0x0;
+	/* Built by BuildGraph() once all dependencies were added. Any modification invalidates it. */
+	DependencyGraph Graph;
+	bool bIsGraphOutdated = true;
 
 public:
 	DependencyManager() = default;
@@ -36,7 +50,11 @@ public:
 	DependencyManager(int32 ObjectToTrack);
 
 private:
-	void VisitIndexAndDependencies(int32 Index, OnVisitCallbackType Callback) const;
+	DependencyGraph CreateGraph() const;
+
+	/* Iterative post-order DFS. Dependencies are always visited before the objects requiring them. */
+	template<typename CallbackType>
+	static void VisitNodeAndDependencies(const DependencyGraph& InGraph, int32 StartNode, CallbackType& Callback, std::vector<bool>& VisitedNodes, std::vector<std::pair<int32, int32>>& NodeStack);
 
 public:
 	void SetExists(const int32 DepedantIdx);
@@ -45,10 +63,16 @@ public:
 
 	void SetDependencies(const int32 DepedantIdx, std::unordered_set<int32>&& Dependencies);
 
+	/* Builds the graph used for all visits. Visits without a prior call to BuildGraph(), or after a modification, build a temporary graph. */
+	void BuildGraph();
+
 	size_t GetNumEntries() const;
 
-	void VisitIndexAndDependenciesWithCallback(int32 Index, OnVisitCallbackType Callback) const;
-	void VisitAllNodesWithCallback(OnVisitCallbackType Callback) const;
+	template<typename CallbackType>
+	void VisitIndexAndDependenciesWithCallback(int32 Index, CallbackType&& Callback) const;
+
+	template<typename CallbackType>
+	void VisitAllNodesWithCallback(CallbackType&& Callback) const;
 
 public:
 	const auto DEBUG_DependencyMap() const
@@ -56,3 +80,79 @@ public:
 		return AllDependencies;
 	}
 };
+
+
+template<typename CallbackType>
+inline void DependencyManager::VisitNodeAndDependencies(const DependencyGraph& InGraph, int32 StartNode, CallbackType& Callback, std::vector<bool>& VisitedNodes, std::vector<std::pair<int32, int32>>& NodeStack)
+{
+	if (VisitedNodes[StartNode])
+		return;
+
+	VisitedNodes[StartNode] = true;
+
+	/* Pairs of node and the position of the next edge to follow */
+	NodeStack.emplace_back(StartNode, InGraph.EdgeOffsets[StartNode]);
+
+	while (!NodeStack.empty())
+	{
+		auto& [Node, NextEdge] = NodeStack.back();
+
+		if (NextEdge < InGraph.EdgeOffsets[Node + 1])
+		{
+			const int32 Dependency = InGraph.Edges[NextEdge++];
+
+			if (!VisitedNodes[Dependency])
+			{
+				VisitedNodes[Dependency] = true;
+				NodeStack.emplace_back(Dependency, InGraph.EdgeOffsets[Dependency]);
+			}
+
+			continue;
+		}
+
+		Callback(InGraph.NodeIndices[Node]);
+		NodeStack.pop_back();
+	}
+}
+
+template<typename CallbackType>
+inline void DependencyManager::VisitIndexAndDependenciesWithCallback(int32 Index, CallbackType&& Callback) const
+{
+	DependencyGraph TemporaryGraph;
+
+	if (bIsGraphOutdated)
+		TemporaryGraph = CreateGraph();
+
+	const DependencyGraph& VisitedGraph = bIsGraphOutdated ? TemporaryGraph : Graph;
+
+	auto It = VisitedGraph.ObjectIndexToNode.find(Index);
+
+	if (It == VisitedGraph.ObjectIndexToNode.end())
+		return;
+
+	std::vector<bool> VisitedNodes(VisitedGraph.NodeIndices.size(), false);
+	std::vector<std::pair<int32, int32>> NodeStack;
+
+	VisitNodeAndDependencies(VisitedGraph, It->second, Callback, VisitedNodes, NodeStack);
+}
+
+template<typename CallbackType>
+inline void DependencyManager::VisitAllNodesWithCallback(CallbackType&& Callback) const
+{
+	DependencyGraph TemporaryGraph;
+
+	if (bIsGraphOutdated)
+		TemporaryGraph = CreateGraph();
+
+	const DependencyGraph& VisitedGraph = bIsGraphOutdated ? TemporaryGraph : Graph;
+
+	const int32 NumNodes = static_cast<int32>(VisitedGraph.NodeIndices.size());
+
+	std::vector<bool> VisitedNodes(NumNodes, false);
+	std::vector<std::pair<int32, int32>> NodeStack;
+
+	for (int32 i = 0; i < NumNodes; i++)
+	{
+		VisitNodeAndDependencies(VisitedGraph, i, Callback, VisitedNodes, NodeStack);
+	}
+}
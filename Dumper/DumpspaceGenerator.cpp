@@ -320,18 +320,22 @@ DSGen::MemberType DumpspaceGenerator::GetMemberType(const PropertyWrapper& Prope
 		return Type;
 	}
 
+	return GetMemberType(Property.GetUnrealProperty(), bIsReference);
+}
+
+DSGen::MemberType DumpspaceGenerator::GetMemberType(UEProperty Property, bool bIsReference)
+{
+	/* Dumpspace doesn't use cycle-fixups, so the type doesn't depend on the package */
+	DSGen::MemberType Type = MemberTypes.FindOrAdd(Property, -1, [Property]() -> DSGen::MemberType { return CreateMemberType(Property); });
 	Type.reference = bIsReference;
-	Type.type = GetMemberEType(Property);
-	Type.typeName = GetMemberTypeStr(Property.GetUnrealProperty(), Type.extendedType, Type.subTypes);
 
 	return Type;
 }
 
-DSGen::MemberType DumpspaceGenerator::GetMemberType(UEProperty Property, bool bIsReference)
+DSGen::MemberType DumpspaceGenerator::CreateMemberType(UEProperty Property)
 {
 	DSGen::MemberType Type;
 
-	Type.reference = bIsReference;
 	Type.type = GetMemberEType(Property);
 	Type.typeName = GetMemberTypeStr(Property, Type.extendedType, Type.subTypes);
 
@@ -458,6 +462,8 @@ void DumpspaceGenerator::Generate()
 	/* Set the output directory of DSGen to "...GenerationPath/GameVersion-GameName/Dumespace" */
 	DSGen::setDirectory(MainFolder);
 
+	MemberTypes.Clear();
+
 	/* Add offsets for GObjects, GNames, GWorld, AppendString, PrcessEvent and ProcessEventIndex*/
 	GeneratedStaticOffsets();
 
@@ -478,7 +484,7 @@ void DumpspaceGenerator::Generate()
 			DSGen::bakeEnum(Enum);
 		}
 
-		DependencyManager::OnVisitCallbackType GenerateClassOrStructCallback = [&](int32 Index) -> void
+		auto GenerateClassOrStructCallback = [&](int32 Index) -> void
 		{
 			DSGen::ClassHolder StructOrClass = GenerateStruct(ObjectArray::GetByIndex<UEStruct>(Index));
 			DSGen::bakeStructOrClass(StructOrClass);
@@ -5,6 +5,7 @@
 #include "StructWrapper.h"
 #include "MemberWrappers.h"
 #include "PackageManager.h"
+#include "PropertyTypeCache.h"
 
 #include "ExternalDependencies/Dumpspace/DSGen.h"
 
@@ -20,6 +21,9 @@ private:
 public:
     static inline PredefinedMemberLookupMapType PredefinedMembers;
 
+    /* MemberTypes of properties, with 'reference' always being false */
+    static inline PropertyTypeCache<DSGen::MemberType> MemberTypes;
+
     static inline std::string MainFolderName = "Dumpspace";
     static inline std::string SubfolderName = "";
 
@@ -40,6 +44,7 @@ private:
     static DSGen::MemberType GetMemberType(const StructWrapper& Struct);
     static DSGen::MemberType GetMemberType(UEProperty Property, bool bIsReference = false);
     static DSGen::MemberType GetMemberType(const PropertyWrapper& Property, bool bIsReference = false);
+    static DSGen::MemberType CreateMemberType(UEProperty Property);
     static DSGen::MemberType ManualCreateMemberType(DSGen::EType Type, const std::string& TypeName, const std::string& ExtendedType = "");
     static void AddMemberToStruct(DSGen::ClassHolder& Struct, const PropertyWrapper& Property);
 
@@ -1,5 +1,6 @@
 #pragma once
 #include "CollisionManager.h"
+#include "IndexedInfoMap.h"
 
 class EnumInfoHandle;
 
@@ -90,14 +91,14 @@ private:
 	friend class EnumManagerTest;
 
 public:
-	using OverrideMaptType = std::unordered_map<int32 /* EnumIndex */, EnumInfo>;
+	using OverrideMaptType = IndexedInfoMap<EnumInfo>;
 	using IllegalNameContaierType = std::vector<HashStringTableIndex>;
 
 private:
 	/* NameTable containing names of all enums as well as information on name-collisions */
 	static inline HashStringTable UniqueEnumNameTable;
 
-	/* Map containing infos on all enums. Implemented due to information missing in the Unreal's reflection system (EnumSize). */
+	/* Infos on all enums, indexed by the enums' GObjects-index. Implemented due to information missing in the Unreal's reflection system (EnumSize). */
 	static inline OverrideMaptType EnumInfoOverrides;
 
 	/* NameTable containing names of all enum-values as well as information on name-collisions */
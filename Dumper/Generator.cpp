@@ -4,8 +4,14 @@
 #include "EnumManager.h"
 #include "MemberManager.h"
 #include "PackageManager.h"
+#include "ReflectionSnapshot.h"
+#include "OffsetCache.h"
 #include "Utils.h"
 
+#include <array>
+#include <future>
+#include <chrono>
+
 inline void InitWeakObjectPtrSettings()
 {
 	UEStruct LoadAsset = ObjectArray::FindObjectFast<UEFunction>("LoadAsset", EClassCastFlags::Function);
@@ -80,35 +86,153 @@ void Generator::InitEngineCore()
 	/* Multiversus [Unsupported, weird GObjects-struct] */
 	//InitObjectArrayDecryption([](void* ObjPtr) -> uint8* { return reinterpret_cast<uint8*>(uint64(ObjPtr) ^ 0x1B5DEAFD6B4068C); });
 
-	ObjectArray::Init();
-	FName::Init();
-	Off::Init();
-	PropertySizes::Init();
-	Off::InSDK::ProcessEvent::InitPE(); //Must be at this position, relies on offsets initialized in Off::Init()
+	if (!OffsetCache::TryInitFromCache())
+	{
+		ObjectArray::Init();
+		FName::Init();
+		Off::Init();
+		PropertySizes::Init();
+		Off::InSDK::ProcessEvent::InitPE(); //Must be at this position, relies on offsets initialized in Off::Init()
+
+		Off::InSDK::World::InitGWorld(); //Must be at this position, relies on offsets initialized in Off::Init()
 
-	Off::InSDK::World::InitGWorld(); //Must be at this position, relies on offsets initialized in Off::Init()
+		Off::InSDK::Text::InitTextOffsets(); //Must be at this position, relies on offsets initialized in Off::InitPE()
 
-	Off::InSDK::Text::InitTextOffsets(); //Must be at this position, relies on offsets initialized in Off::InitPE()
+		OffsetCache::Save();
+	}
 
+	/* Not cached, depends on the objects and not only on the game-binary */
 	InitSettings();
+
+	/* Requires the FName layout, initialized in Off::Init() */
+	FNameStringCache::Init();
+
+	/* All offsets are known now, IsA doesn't need to lock from here on */
+	ObjectArray::FreezeHierarchyIndex();
 }
 
 void Generator::InitInternal()
 {
-	// Initialize PackageManager with all packages, their names, structs, classes enums, functions and dependencies
-	PackageManager::Init();
-
-	// Initialize StructManager with all structs and their names
-	StructManager::Init();
-	
-	// Initialize EnumManager with all enums and their names
-	EnumManager::Init();
-	
-	// Initialized all Member-Name collisions
-	MemberManager::Init();
-
-	// Post-Initialize PackageManager after StructManager has been initialized. 'PostInit()' handles Cyclic-Dependencies detection
-	PackageManager::PostInit();
+	struct InitTask
+	{
+		const char* Name;
+		void(*Function)();
+
+		/* Tasks that need to be finished before this task is started, always lower than the index of this task */
+		std::vector<int32> Dependencies;
+	};
+
+	/* Package-, Struct-, Enum- and MemberManager only read GObjects and write their own tables, they're independent from each other */
+	const std::array<InitTask, 5> Tasks = { {
+		// Initialize PackageManager with all packages, their names, structs, classes enums, functions and dependencies
+		{ "PackageManager::Init", PackageManager::Init, {} },
+
+		// Initialize StructManager with all structs and their names
+		{ "StructManager::Init", StructManager::Init, {} },
+
+		// Initialize EnumManager with all enums and their names
+		{ "EnumManager::Init", EnumManager::Init, {} },
+
+		// Initialized all Member-Name collisions
+		{ "MemberManager::Init", MemberManager::Init, {} },
+
+		// Post-Initialize PackageManager after StructManager has been initialized. 'PostInit()' handles Cyclic-Dependencies detection
+		{ "PackageManager::PostInit", PackageManager::PostInit, { 0, 1 } },
+	} };
+
+	const auto StartTime = std::chrono::high_resolution_clock::now();
+
+	auto GetMsSinceStart = [StartTime]() -> double
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - StartTime).count();
+	};
+
+	InitTimings.assign(Tasks.size(), InitTaskTiming{});
+
+	auto RunTask = [&](int32 TaskIndex) -> void
+	{
+		const InitTask& Task = Tasks[TaskIndex];
+		InitTaskTiming& Timing = InitTimings[TaskIndex];
+
+		Timing.Name = Task.Name;
+		Timing.CriticalDependency = -1;
+
+		for (const int32 Dependency : Task.Dependencies)
+		{
+			if (Timing.CriticalDependency == -1 || InitTimings[Dependency].EndMs > InitTimings[Timing.CriticalDependency].EndMs)
+				Timing.CriticalDependency = Dependency;
+		}
+
+		Timing.StartMs = GetMsSinceStart();
+		Task.Function();
+		Timing.EndMs = GetMsSinceStart();
+	};
+
+	if constexpr (Settings::Generator::bInitializeManagersConcurrently)
+	{
+		/* All tasks without dependencies start at once, they share the threads ObjectArray::ParallelForEach() would otherwise use for each of them */
+		int32 NumTasksWithoutDependencies = 0;
+		for (const InitTask& Task : Tasks)
+			NumTasksWithoutDependencies += Task.Dependencies.empty();
+
+		const int32 NumThreads = Settings::Generator::NumObjectArrayThreads > 0 ? Settings::Generator::NumObjectArrayThreads : static_cast<int32>(std::thread::hardware_concurrency());
+		const int32 ThreadsPerTask = NumThreads > NumTasksWithoutDependencies ? (NumThreads / NumTasksWithoutDependencies) : 1;
+
+		std::array<std::shared_future<void>, Tasks.size()> TaskFutures;
+
+		for (int32 i = 0; i < Tasks.size(); i++)
+		{
+			TaskFutures[i] = std::async(std::launch::async, [&, i]() -> void
+			{
+				/* Rethrows the exception of a failed dependency, this task isn't run if any of its dependencies failed */
+				for (const int32 Dependency : Tasks[i].Dependencies)
+					TaskFutures[Dependency].get();
+
+				/* std::async might reuse this thread, the limit must not outlive the task */
+				ObjectArray::SetParallelForEachThreadLimit(ThreadsPerTask);
+				RunTask(i);
+				ObjectArray::SetParallelForEachThreadLimit(0);
+			}).share();
+		}
+
+		for (const std::shared_future<void>& Future : TaskFutures)
+			Future.get();
+	}
+	else
+	{
+		for (int32 i = 0; i < Tasks.size(); i++)
+			RunTask(i);
+	}
+
+	if constexpr (!Settings::Debug::bPrintInitTimings)
+		return;
+
+	/* The critical path ends at the task that finished last and follows the dependency each task waited for the longest */
+	int32 LastTask = 0;
+	for (int32 i = 1; i < InitTimings.size(); i++)
+	{
+		if (InitTimings[i].EndMs > InitTimings[LastTask].EndMs)
+			LastTask = i;
+	}
+
+	std::string CriticalPath;
+	for (int32 i = LastTask; i != -1; i = InitTimings[i].CriticalDependency)
+		CriticalPath = i == LastTask ? InitTimings[i].Name : std::format("{} -> {}", InitTimings[i].Name, CriticalPath);
+
+	std::cout << std::format("Initialization took {:.2f}ms, critical path: {}\n", InitTimings[LastTask].EndMs, CriticalPath);
+
+	for (const InitTaskTiming& Timing : InitTimings)
+		std::cout << std::format("\t{:<25} {:>10.2f}ms - {:>10.2f}ms ({:.2f}ms)\n", Timing.Name, Timing.StartMs, Timing.EndMs, Timing.EndMs - Timing.StartMs);
+
+	std::cout << std::endl;
+}
+
+bool Generator::GenerateReflectionSnapshot()
+{
+	if (DumperFolder.empty() && !SetupDumperFolder())
+		return false;
+
+	return ReflectionSnapshot::Write(DumperFolder / "ReflectionSnapshot.bin");
 }
 
 bool Generator::SetupDumperFolder()
@@ -121,7 +245,8 @@ bool Generator::SetupDumperFolder()
 
 		DumperFolder = fs::path(Settings::Generator::SDKGenerationPath) / FolderName;
 
-		if (fs::exists(DumperFolder))
+		/* The output of generators keeping their previous output lives in here, all other generators move their own folder to '_OLD' in SetupFolders() */
+		if (fs::exists(DumperFolder) && !Settings::Generator::bOnlyWriteChangedFiles)
 		{
 			fs::path Old = DumperFolder.generic_string() + "_OLD";
 
@@ -149,7 +274,7 @@ bool Generator::SetupFolders(std::string& FolderName, fs::path& OutFolder)
 	return SetupFolders(FolderName, OutFolder, EmptyName, Dummy);
 }
 
-bool Generator::SetupFolders(std::string& FolderName, fs::path& OutFolder, std::string& SubfolderName, fs::path& OutSubFolder)
+bool Generator::SetupFolders(std::string& FolderName, fs::path& OutFolder, std::string& SubfolderName, fs::path& OutSubFolder, bool bKeepPreviousOutput)
 {
 	FileNameHelper::MakeValidFileName(FolderName);
 	FileNameHelper::MakeValidFileName(SubfolderName);
@@ -159,7 +284,8 @@ bool Generator::SetupFolders(std::string& FolderName, fs::path& OutFolder, std::
 		OutFolder = DumperFolder / FolderName;
 		OutSubFolder = OutFolder / SubfolderName;
 				
-		if (fs::exists(OutFolder))
+		/* If kept, files of the previous run are compared against, and replaced by, the newly generated ones */
+		if (fs::exists(OutFolder) && !bKeepPreviousOutput)
 		{
 			fs::path Old = OutFolder.generic_string() + "_OLD";
 
@@ -1,5 +1,9 @@
 #pragma once
 #include <filesystem>
+#include <array>
+#include <vector>
+#include <thread>
+#include <exception>
 
 #include "ObjectArray.h"
 #include "DependencyManager.h"
@@ -33,6 +37,18 @@ concept GeneratorImplementation = requires(GeneratorType t)
     GeneratorType::InitPredefinedFunctions();
 };
 
+struct InitTaskTiming
+{
+    const char* Name;
+
+    /* Relative to the start of Generator::InitInternal() */
+    double StartMs;
+    double EndMs;
+
+    /* Task which finished last out of all tasks this task waited for, -1 if it didn't wait for any */
+    int32 CriticalDependency;
+};
+
 class Generator
 {
 private:
@@ -42,24 +58,29 @@ private:
     static inline fs::path DumperFolder;
     static inline bool bDumpedGObjects = false;
 
+    /* Timings of the tasks run by the last call to InitInternal() */
+    static inline std::vector<InitTaskTiming> InitTimings;
+
 public:
     static void InitEngineCore();
     static void InitInternal();
 
+    static inline const std::vector<InitTaskTiming>& GetInitTimings() { return InitTimings; }
+
 private:
     static bool SetupDumperFolder();
 
     static bool SetupFolders(std::string& FolderName, fs::path& OutFolder);
-    static bool SetupFolders(std::string& FolderName, fs::path& OutFolder, std::string& SubfolderName, fs::path& OutSubFolder);
+    static bool SetupFolders(std::string& FolderName, fs::path& OutFolder, std::string& SubfolderName, fs::path& OutSubFolder, bool bKeepPreviousOutput = false);
 
-public:
+    /* Sets up the folders and predefined members of this generator, returns false if the folders couldn't be created */
     template<GeneratorImplementation GeneratorType>
-    static void Generate() 
-    { 
+    static bool PrepareGenerator()
+    {
         if (DumperFolder.empty())
         {
             if (!SetupDumperFolder())
-                return;
+                return false;
 
             if (!bDumpedGObjects)
             {
@@ -71,14 +92,92 @@ public:
             }
         }
 
-        if (!SetupFolders(GeneratorType::MainFolderName, GeneratorType::MainFolder, GeneratorType::SubfolderName, GeneratorType::Subfolder))
-            return;
+        /* Only generators declaring 'bKeepPreviousOutput' keep their folder, all others move their previous output to '_OLD' */
+        constexpr bool bKeepPreviousOutput = requires { requires GeneratorType::bKeepPreviousOutput; };
+
+        if (!SetupFolders(GeneratorType::MainFolderName, GeneratorType::MainFolder, GeneratorType::SubfolderName, GeneratorType::Subfolder, bKeepPreviousOutput))
+            return false;
 
         GeneratorType::InitPredefinedMembers();
         GeneratorType::InitPredefinedFunctions();
 
+        return true;
+    }
+
+    template<GeneratorImplementation GeneratorType>
+    static void RunGenerator()
+    {
+        /* The lookup is thread_local, so generators running concurrently each use their own predefined members */
         MemberManager::SetPredefinedMemberLookupPtr(&GeneratorType::PredefinedMembers);
 
         GeneratorType::Generate();
+    }
+
+public:
+    /* Writes a ReflectionSnapshot of the current process into the SDK folder of this game */
+    static bool GenerateReflectionSnapshot();
+
+    template<GeneratorImplementation GeneratorType>
+    static void Generate() 
+    { 
+        if (!PrepareGenerator<GeneratorType>())
+            return;
+
+        RunGenerator<GeneratorType>();
     };
+
+    /*
+    * Runs all generators, with Settings::Generator::bRunGeneratorsConcurrently each of them on its own thread.
+    * Generators only read the data of the managers, so the total time is that of the slowest generator instead of the sum of all of them.
+    * An exception thrown by a generator is rethrown on the calling thread after all generators finished.
+    */
+    template<GeneratorImplementation... GeneratorTypes>
+    static void GenerateAll()
+    {
+        if constexpr (!Settings::Generator::bRunGeneratorsConcurrently)
+        {
+            (Generate<GeneratorTypes>(), ...);
+            return;
+        }
+
+        /* Folders are set up sequentially, the first generator also sets up the DumperFolder */
+        const std::array<bool, sizeof...(GeneratorTypes)> bWasPrepared = { PrepareGenerator<GeneratorTypes>()... };
+
+        /* An exception escaping a generator thread would terminate the game, it's rethrown on this thread once all generators finished */
+        std::array<std::exception_ptr, sizeof...(GeneratorTypes)> GeneratorExceptions;
+
+        std::vector<std::thread> GeneratorThreads;
+        GeneratorThreads.reserve(sizeof...(GeneratorTypes));
+
+        int32 GeneratorIndex = 0;
+
+        ([&]() -> void
+        {
+            const int32 Index = GeneratorIndex++;
+
+            if (!bWasPrepared[Index])
+                return;
+
+            GeneratorThreads.emplace_back([&GeneratorExceptions, Index]() -> void
+            {
+                try
+                {
+                    RunGenerator<GeneratorTypes>();
+                }
+                catch (...)
+                {
+                    GeneratorExceptions[Index] = std::current_exception();
+                }
+            });
+        }(), ...);
+
+        for (std::thread& Thread : GeneratorThreads)
+            Thread.join();
+
+        for (const std::exception_ptr& Exception : GeneratorExceptions)
+        {
+            if (Exception)
+                std::rethrow_exception(Exception);
+        }
+    }
 };
@@ -13,6 +13,12 @@ HashStringTable::HashStringTable(uint32 InitialBucketSize)
 
         CurrentBucket.Size = 0x0;
         CurrentBucket.SizeMax = InitialBucketSize;
+
+        CurrentBucket.Slots = static_cast<IndexSlot*>(malloc(InitialNumIndexSlots * sizeof(IndexSlot)));
+        CurrentBucket.NumSlots = InitialNumIndexSlots;
+        CurrentBucket.NumEntries = 0x0;
+
+        memset(CurrentBucket.Slots, 0xFF, InitialNumIndexSlots * sizeof(IndexSlot));
     }
 }
 
@@ -22,6 +28,12 @@ HashStringTable::~HashStringTable()
     {
         StringBucket& CurrentBucket = Buckets[i];
 
+        if (CurrentBucket.Slots)
+        {
+            free(CurrentBucket.Slots);
+            CurrentBucket.Slots = nullptr;
+        }
+
         if (!CurrentBucket.Data)
             continue;
 
@@ -74,8 +86,53 @@ void HashStringTable::ResizeBucket(StringBucket& Bucket)
     Bucket.SizeMax = NewBucketSizeMax;
 }
 
+void HashStringTable::ResizeIndex(StringBucket& Bucket)
+{
+    IndexSlot* OldSlots = Bucket.Slots;
+    const uint32 OldNumSlots = Bucket.NumSlots;
+
+    Bucket.NumSlots = OldNumSlots * 2;
+    Bucket.Slots = static_cast<IndexSlot*>(malloc(Bucket.NumSlots * sizeof(IndexSlot)));
+    Bucket.NumEntries = 0x0;
+
+    assert(Bucket.Slots != nullptr && "Malloc failed in function 'ResizeIndex()'.");
+
+    memset(Bucket.Slots, 0xFF, Bucket.NumSlots * sizeof(IndexSlot));
+
+    /* The full hash is stored in the slot, no need to rehash the strings themselves */
+    for (uint32 i = 0; i < OldNumSlots; i++)
+    {
+        if (OldSlots[i].InBucketOffset != IndexSlot::EmptySlot)
+            AddToIndex(Bucket, OldSlots[i].FullHash, OldSlots[i].InBucketOffset);
+    }
+
+    free(OldSlots);
+}
+
+void HashStringTable::AddToIndex(StringBucket& Bucket, uint32 FullHash, uint32 InBucketOffset)
+{
+    /* Keep the load-factor below 50% to keep probe-sequences short */
+    if (((Bucket.NumEntries + 1) * 2) > Bucket.NumSlots)
+        ResizeIndex(Bucket);
+
+    const uint32 SlotMask = Bucket.NumSlots - 1;
+
+    for (uint32 SlotIdx = FullHash & SlotMask; true; SlotIdx = (SlotIdx + 1) & SlotMask)
+    {
+        IndexSlot& Slot = Bucket.Slots[SlotIdx];
+
+        if (Slot.InBucketOffset != IndexSlot::EmptySlot)
+            continue;
+
+        Slot.FullHash = FullHash;
+        Slot.InBucketOffset = InBucketOffset;
+        Bucket.NumEntries++;
+        return;
+    }
+}
+
 template<typename CharType>
-std::pair<HashStringTableIndex, bool> HashStringTable::AddUnchecked(const CharType* Str, int32 Length, uint8 Hash)
+std::pair<HashStringTableIndex, bool> HashStringTable::AddUnchecked(const CharType* Str, int32 Length, uint8 Hash, uint32 FullHash)
 {
     static_assert(std::is_same_v<CharType, char> || std::is_same_v<CharType, wchar_t>, "Invalid CharType! Type must be 'char' or 'wchar_t'.");
 
@@ -106,6 +163,8 @@ std::pair<HashStringTableIndex, bool> HashStringTable::AddUnchecked(const CharTy
     ReturnIndex.HashIndex = Hash;
     ReturnIndex.InBucketOffset = Bucket.Size;
 
+    AddToIndex(Bucket, FullHash, Bucket.Size);
+
     Bucket.Size += NewEmptyEntry.GetLengthBytes();
 
     return { ReturnIndex, true };
@@ -135,23 +194,30 @@ const StringEntry& HashStringTable::GetStringEntry(HashStringTableIndex Index) c
 }
 
 template<typename CharType>
-HashStringTableIndex HashStringTable::Find(const CharType* Str, int32 Length, uint8 Hash)
+HashStringTableIndex HashStringTable::FindWithFullHash(const CharType* Str, int32 Length, uint8 Hash, uint32 FullHash) const
 {
     constexpr bool bIsWchar = std::is_same_v<CharType, wchar_t>;
 
-    StringBucket& Bucket = Buckets[Hash];
+    const StringBucket& Bucket = Buckets[Hash];
 
-    /* Try to find duplications withing 'checked' regions */
-    for (auto It = HashBucketIterator::begin(Bucket); It != HashBucketIterator::end(Bucket); ++It)
+    const uint32 SlotMask = Bucket.NumSlots - 1;
+
+    /* Probe until an empty slot is hit, only compare strings if the full hash matches */
+    for (uint32 SlotIdx = FullHash & SlotMask; Bucket.Slots[SlotIdx].InBucketOffset != IndexSlot::EmptySlot; SlotIdx = (SlotIdx + 1) & SlotMask)
     {
-        const StringEntry& Entry = *It;
+        const IndexSlot& Slot = Bucket.Slots[SlotIdx];
+
+        if (Slot.FullHash != FullHash)
+            continue;
+
+        const StringEntry& Entry = GetStringEntry(Bucket, Slot.InBucketOffset);
 
         if (Entry.Length == Length && Entry.bIsWide == bIsWchar && Strcmp(Str, Entry) == 0)
         {
             HashStringTableIndex Idx;
             Idx.Unused = 0x0;
             Idx.HashIndex = Hash;
-            Idx.InBucketOffset = It.GetInBucketIndex();
+            Idx.InBucketOffset = Slot.InBucketOffset;
 
             return Idx;
         }
@@ -160,6 +226,12 @@ HashStringTableIndex HashStringTable::Find(const CharType* Str, int32 Length, ui
     return HashStringTableIndex::FromInt(-1);
 }
 
+template<typename CharType>
+HashStringTableIndex HashStringTable::Find(const CharType* Str, int32 Length, uint8 Hash)
+{
+    return FindWithFullHash(Str, Length, Hash, FullWidthHash(Str, Length * sizeof(CharType)));
+}
+
 template<typename CharType>
 inline std::pair<HashStringTableIndex, bool> HashStringTable::FindOrAdd(const CharType* Str, int32 Length, bool bShouldMarkAsDuplicated)
 {
@@ -173,9 +245,10 @@ inline std::pair<HashStringTableIndex, bool> HashStringTable::FindOrAdd(const Ch
         return { HashStringTableIndex(-1), false };
     }
 
-    uint8 Hash = SmallPearsonHash(Str);
+    const uint8 Hash = SmallPearsonHash(Str);
+    const uint32 FullHash = FullWidthHash(Str, Length * sizeof(CharType));
 
-    HashStringTableIndex ExistingIndex = Find(Str, Length, Hash);
+    HashStringTableIndex ExistingIndex = FindWithFullHash(Str, Length, Hash, FullHash);
 
     if (ExistingIndex != -1)
     {
@@ -192,7 +265,7 @@ inline std::pair<HashStringTableIndex, bool> HashStringTable::FindOrAdd(const Ch
     }
 
     // Only reached if Str wasn't found in StringTable, else entry is marked as not unique
-    return AddUnchecked(Str, Length, Hash);
+    return AddUnchecked(Str, Length, Hash, FullHash);
 }
 
 /* returns pair<Index, bWasAdded> */
@@ -227,7 +300,7 @@ void HashStringTable::DebugPrintStats() const
         TotalMemoryUsed += Bucket.Size;
         TotalMemoryAllocated += Bucket.SizeMax;
 
-        std::cout << std::format("Bucket[{:02d}] = {{ Data = {:p}, Size = {:05X}, SizeMax = {:05X} }}\n", i, static_cast<void*>(Bucket.Data), Bucket.Size, Bucket.SizeMax);
+        std::cout << std::format("Bucket[{:02d}] = {{ Data = {:p}, Size = {:05X}, SizeMax = {:05X}, NumEntries = {:05X}, NumSlots = {:05X} }}\n", i, static_cast<void*>(Bucket.Data), Bucket.Size, Bucket.SizeMax, Bucket.NumEntries, Bucket.NumSlots);
     }
 
     std::cout << std::endl;
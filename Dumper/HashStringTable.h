@@ -32,6 +32,22 @@ inline uint8 SmallPearsonHash(const char* StringToHash)
     return (Hash & HashMask);
 }
 
+/* 32-bit FNV-1a, used to index strings within one bucket of the HashStringTable */
+inline uint32 FullWidthHash(const void* Data, int32 LengthBytes)
+{
+    const uint8* Bytes = static_cast<const uint8*>(Data);
+
+    uint32 Hash = 0x811C9DC5;
+
+    for (int32 i = 0; i < LengthBytes; i++)
+    {
+        Hash ^= Bytes[i];
+        Hash *= 0x01000193;
+    }
+
+    return Hash;
+}
+
 /* Used to limit access to StringEntry::OptionalCollisionCount to authorized (friend) classes only */
 struct AccessLimitedCollisionCount
 {
@@ -167,13 +183,29 @@ private:
     /* Checked, Unchecked */
     static constexpr int64 NumSectionsPerBucket = 2;
 
+    /* Initial number of slots in the open-addressed index of each bucket, must be a power of two */
+    static constexpr uint32 InitialNumIndexSlots = 0x400;
+
 private:
+    struct IndexSlot
+    {
+        static constexpr uint32 EmptySlot = 0xFFFFFFFF;
+
+        uint32 FullHash;
+        uint32 InBucketOffset;
+    };
+
     struct StringBucket
     {
         // One allocated block, split in two sections, checked and unchecked
         uint8* Data;
         uint32 Size;
         uint32 SizeMax;
+
+        // Open-addressed (linear probing) index into 'Data', NumSlots is always a power of two
+        IndexSlot* Slots;
+        uint32 NumSlots;
+        uint32 NumEntries;
     };
 
 private:
@@ -277,9 +309,14 @@ private:
     const StringEntry& GetStringEntry(int32 BucketIndex, int32 InBucketIndex) const;
 
     void ResizeBucket(StringBucket& Bucket);
+    void ResizeIndex(StringBucket& Bucket);
+    void AddToIndex(StringBucket& Bucket, uint32 FullHash, uint32 InBucketOffset);
+
+    template<typename CharType>
+    HashStringTableIndex FindWithFullHash(const CharType* Str, int32 Length, uint8 Hash, uint32 FullHash) const;
 
     template<typename CharType>
-    std::pair<HashStringTableIndex, bool> AddUnchecked(const CharType* Str, int32 Length, uint8 Hash);
+    std::pair<HashStringTableIndex, bool> AddUnchecked(const CharType* Str, int32 Length, uint8 Hash, uint32 FullHash);
 
 public:
     const StringEntry& operator[](HashStringTableIndex Index) const;
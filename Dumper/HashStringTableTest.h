@@ -15,6 +15,7 @@ public:
 		TestUniqueNames<bDoDebugPrinting>();
 		TestUniqueMemberNames<bDoDebugPrinting>();
 		TestUniqueStructNames<bDoDebugPrinting>();
+		TestIndexGrowth<bDoDebugPrinting>();
 		PrintDbgMessage<bDoDebugPrinting>("");
 	}
 
@@ -179,4 +180,49 @@ public:
 
 		std::cout << __FUNCTION__ << ": " << (bSuccededTestWithoutError ? "SUCCEEDED!" : "FAILED!") << std::endl;
 	}
+
+	template<bool bDoDebugPrinting = false>
+	static inline void TestIndexGrowth()
+	{
+		HashStringTable Desktop(0x100);
+
+		/* Enough names to force every bucket-index to be resized multiple times */
+		constexpr int32 NumNamesToAdd = 0x40000;
+
+		std::vector<HashStringTableIndex> AddedIndices;
+		AddedIndices.reserve(NumNamesToAdd);
+
+		bool bSuccededTestWithoutError = true;
+
+		for (int i = 0; i < NumNamesToAdd; i++)
+		{
+			auto [Index, bWasAdded] = Desktop.FindOrAdd(std::format("Name_{:X}", i));
+
+			if (!bWasAdded)
+			{
+				PrintDbgMessage<bDoDebugPrinting>("Name_{:X} was not added!", i);
+				SetBoolIfFailed(bSuccededTestWithoutError, false);
+			}
+
+			AddedIndices.push_back(Index);
+		}
+
+		for (int i = 0; i < NumNamesToAdd; i++)
+		{
+			auto [Index, bWasAdded] = Desktop.FindOrAdd(std::format("Name_{:X}", i), false);
+
+			if (bWasAdded || Index != AddedIndices[i])
+			{
+				PrintDbgMessage<bDoDebugPrinting>("Name_{:X} was not found at its original index!", i);
+				SetBoolIfFailed(bSuccededTestWithoutError, false);
+			}
+		}
+
+		if constexpr (bDoDebugPrinting)
+		{
+			Desktop.DebugPrintStats();
+		}
+
+		std::cout << __FUNCTION__ << ": " << (bSuccededTestWithoutError ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
 };
\ No newline at end of file
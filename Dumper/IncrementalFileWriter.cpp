@@ -0,0 +1,381 @@
+#include <iostream>
+#include <fstream>
+#include <format>
+#include <chrono>
+#include <charconv>
+
+#include "IncrementalFileWriter.h"
+#include "Settings.h"
+
+
+uint64 IncrementalFileWriter::HashContent(std::string_view Content)
+{
+	/* 64bit FNV-1a, stable across runs and compilers unlike std::hash */
+	constexpr uint64 FNVOffsetBasis = 0xCBF29CE484222325;
+	constexpr uint64 FNVPrime = 0x100000001B3;
+
+	uint64 Hash = FNVOffsetBasis;
+
+	for (const char C : Content)
+	{
+		Hash ^= static_cast<uint8>(C);
+		Hash *= FNVPrime;
+	}
+
+	return Hash;
+}
+
+std::string IncrementalFileWriter::GetRelativePath(const fs::path& FilePath)
+{
+	const std::u8string RelativePathU8 = FilePath.lexically_relative(RootFolder).generic_u8string();
+
+	return std::string(RelativePathU8.begin(), RelativePathU8.end());
+}
+
+void IncrementalFileWriter::LoadManifest()
+{
+	std::ifstream Manifest(RootFolder / ManifestFileName);
+
+	if (!Manifest.is_open())
+		return;
+
+	/* One line per file, "<hash as hex> <relative path>" */
+	std::string Line;
+	while (std::getline(Manifest, Line))
+	{
+		const size_t SeparatorPos = Line.find(' ');
+
+		if (SeparatorPos == std::string::npos)
+			continue;
+
+		uint64 Hash = 0x0;
+		const auto [HashEnd, Error] = std::from_chars(Line.data(), Line.data() + SeparatorPos, Hash, 16);
+
+		/* Lines of a damaged manifest are ignored, their files are just rewritten */
+		if (Error != std::errc() || HashEnd != (Line.data() + SeparatorPos))
+			continue;
+
+		PreviousHashes[Line.substr(SeparatorPos + 1)] = Hash;
+	}
+}
+
+void IncrementalFileWriter::SaveManifest()
+{
+	std::ofstream Manifest(RootFolder / ManifestFileName);
+
+	if (!Manifest.is_open())
+	{
+		std::cout << "Error opening file \"" << ManifestFileName << "\"" << std::endl;
+		return;
+	}
+
+	for (const auto& [RelativePath, Hash] : CurrentHashes)
+		Manifest << std::format("{:016X} {}\n", Hash, RelativePath);
+}
+
+void IncrementalFileWriter::ProcessPendingFiles()
+{
+	while (true)
+	{
+		std::unique_lock Lock(PendingFilesMutex);
+		PendingFilesCondition.wait(Lock, []() { return !PendingFiles.empty() || bIsStopRequested; });
+
+		/* Remaining files are written before stopping */
+		if (PendingFiles.empty())
+			return;
+
+		auto [FilePath, Content] = std::move(PendingFiles.front());
+		PendingFiles.pop_front();
+
+		Lock.unlock();
+
+		WriteFile(FilePath, Content);
+		ReleaseBuffer(std::move(Content));
+	}
+}
+
+void IncrementalFileWriter::Begin(const fs::path& InRootFolder)
+{
+	RootFolder = InRootFolder;
+
+	PreviousHashes.clear();
+	CurrentHashes.clear();
+
+	NumFilesWritten = 0x0;
+	NumFilesSkipped = 0x0;
+
+	NumBytesWritten = 0x0;
+	IOTimeMicroseconds = 0x0;
+
+	if constexpr (Settings::Generator::bOnlyWriteChangedFiles)
+		LoadManifest();
+
+	if constexpr (Settings::CppGenerator::bWriteFilesAsynchronously)
+	{
+		bIsStopRequested = false;
+		IOThread = std::thread(ProcessPendingFiles);
+	}
+}
+
+void IncrementalFileWriter::End()
+{
+	if (IOThread.joinable())
+	{
+		{
+			std::scoped_lock Lock(PendingFilesMutex);
+			bIsStopRequested = true;
+		}
+
+		PendingFilesCondition.notify_one();
+		IOThread.join();
+	}
+
+	BufferPool.clear();
+	BufferPool.shrink_to_fit();
+
+	std::cout << std::format("Wrote 0x{:X} bytes, {:.2f}ms were spent on file-IO.\n", GetNumBytesWritten(), GetTimeSpentInIOMs()) << std::endl;
+
+	if constexpr (Settings::Generator::bOnlyWriteChangedFiles)
+	{
+		int32 NumFilesRemoved = 0x0;
+
+		for (const auto& [RelativePath, Hash] : PreviousHashes)
+		{
+			if (CurrentHashes.contains(RelativePath))
+				continue;
+
+			const std::u8string RelativePathU8(RelativePath.begin(), RelativePath.end());
+
+			std::error_code Error;
+			if (fs::remove(RootFolder / RelativePathU8, Error))
+				NumFilesRemoved++;
+		}
+
+		std::cout << std::format("Wrote {} changed files, skipped {} unchanged files and removed {} outdated files.\n", NumFilesWritten.load(), NumFilesSkipped.load(), NumFilesRemoved) << std::endl;
+	}
+
+	SaveManifest();
+}
+
+bool IncrementalFileWriter::WriteFile(const fs::path& FilePath, std::string_view Content)
+{
+	const std::string RelativePath = GetRelativePath(FilePath);
+
+	const uint64 Hash = HashContent(Content);
+
+	bool bIsUnchanged = false;
+
+	{
+		std::scoped_lock Lock(HashesMutex);
+
+		auto It = PreviousHashes.find(RelativePath);
+		bIsUnchanged = It != PreviousHashes.end() && It->second == Hash;
+	}
+
+	/* The file could have been deleted since the manifest was written */
+	if (bIsUnchanged && fs::exists(FilePath))
+	{
+		std::scoped_lock Lock(HashesMutex);
+		CurrentHashes[RelativePath] = Hash;
+
+		NumFilesSkipped++;
+		return true;
+	}
+
+	const auto StartTime = std::chrono::high_resolution_clock::now();
+
+	std::ofstream File(FilePath);
+
+	if (!File.is_open())
+	{
+		std::cout << "Error opening file \"" << RelativePath << "\"" << std::endl;
+		return false;
+	}
+
+	File.write(Content.data(), Content.size());
+	File.close();
+
+	/* The hash is only recorded for files that were written completely, others are regenerated by the next run */
+	if (File.fail())
+	{
+		std::cout << "Error writing file \"" << RelativePath << "\"" << std::endl;
+		return false;
+	}
+
+	{
+		std::scoped_lock Lock(HashesMutex);
+		CurrentHashes[RelativePath] = Hash;
+	}
+
+	const auto Duration = std::chrono::high_resolution_clock::now() - StartTime;
+
+	NumFilesWritten++;
+	NumBytesWritten += Content.size();
+	IOTimeMicroseconds += std::chrono::duration_cast<std::chrono::microseconds>(Duration).count();
+
+	return true;
+}
+
+bool IncrementalFileWriter::KeepFile(const fs::path& FilePath)
+{
+	const std::string RelativePath = GetRelativePath(FilePath);
+
+	std::scoped_lock Lock(HashesMutex);
+
+	auto It = PreviousHashes.find(RelativePath);
+
+	if (It == PreviousHashes.end() || !fs::exists(FilePath))
+		return false;
+
+	CurrentHashes[RelativePath] = It->second;
+	NumFilesSkipped++;
+
+	return true;
+}
+
+void IncrementalFileWriter::SubmitFile(const fs::path& FilePath, std::string&& Content)
+{
+	if constexpr (Settings::CppGenerator::bWriteFilesAsynchronously)
+	{
+		if (IOThread.joinable())
+		{
+			{
+				std::scoped_lock Lock(PendingFilesMutex);
+				PendingFiles.emplace_back(FilePath, std::move(Content));
+			}
+
+			PendingFilesCondition.notify_one();
+			return;
+		}
+	}
+
+	WriteFile(FilePath, Content);
+	ReleaseBuffer(std::move(Content));
+}
+
+std::string IncrementalFileWriter::AcquireBuffer()
+{
+	{
+		std::scoped_lock Lock(BufferPoolMutex);
+
+		if (!BufferPool.empty())
+		{
+			std::string Buffer = std::move(BufferPool.back());
+			BufferPool.pop_back();
+
+			return Buffer;
+		}
+	}
+
+	std::string Buffer;
+	Buffer.reserve(InitialBufferSize);
+
+	return Buffer;
+}
+
+void IncrementalFileWriter::ReleaseBuffer(std::string&& Buffer)
+{
+	Buffer.clear();
+
+	std::scoped_lock Lock(BufferPoolMutex);
+	BufferPool.push_back(std::move(Buffer));
+}
+
+
+StringStreamBuffer::StringStreamBuffer(std::string&& InBuffer)
+	: Buffer(std::move(InBuffer))
+{
+}
+
+StringStreamBuffer::StringStreamBuffer(StringStreamBuffer&& Other) noexcept
+	: std::streambuf(), Buffer(std::move(Other.Buffer))
+{
+}
+
+StringStreamBuffer& StringStreamBuffer::operator=(StringStreamBuffer&& Other) noexcept
+{
+	Buffer = std::move(Other.Buffer);
+
+	return *this;
+}
+
+StringStreamBuffer::int_type StringStreamBuffer::overflow(int_type Char)
+{
+	if (!traits_type::eq_int_type(Char, traits_type::eof()))
+		Buffer.push_back(traits_type::to_char_type(Char));
+
+	return traits_type::not_eof(Char);
+}
+
+std::streamsize StringStreamBuffer::xsputn(const char* String, std::streamsize Count)
+{
+	Buffer.append(String, static_cast<size_t>(Count));
+
+	return Count;
+}
+
+std::string_view StringStreamBuffer::GetView() const
+{
+	return Buffer;
+}
+
+std::string StringStreamBuffer::TakeBuffer()
+{
+	return std::move(Buffer);
+}
+
+
+BufferedFileStream::BufferedFileStream()
+	: std::ostream(nullptr)
+{
+	rdbuf(&Buffer);
+}
+
+BufferedFileStream::BufferedFileStream(const fs::path& InFilePath)
+	: std::ostream(nullptr), Buffer(IncrementalFileWriter::AcquireBuffer()), FilePath(InFilePath), bIsOpen(true)
+{
+	rdbuf(&Buffer);
+}
+
+BufferedFileStream::BufferedFileStream(BufferedFileStream&& Other) noexcept
+	: std::ostream(std::move(Other)), Buffer(std::move(Other.Buffer)), FilePath(std::move(Other.FilePath)), bIsOpen(Other.bIsOpen)
+{
+	/* Moving a std::ostream doesn't move the associated streambuf */
+	set_rdbuf(&Buffer);
+
+	Other.bIsOpen = false;
+}
+
+BufferedFileStream::~BufferedFileStream()
+{
+	close();
+}
+
+BufferedFileStream& BufferedFileStream::operator=(BufferedFileStream&& Other) noexcept
+{
+	close();
+
+	std::ostream::operator=(std::move(Other));
+	Buffer = std::move(Other.Buffer);
+	FilePath = std::move(Other.FilePath);
+	bIsOpen = Other.bIsOpen;
+
+	Other.bIsOpen = false;
+
+	return *this;
+}
+
+bool BufferedFileStream::is_open() const
+{
+	return bIsOpen;
+}
+
+void BufferedFileStream::close()
+{
+	if (!bIsOpen)
+		return;
+
+	bIsOpen = false;
+
+	IncrementalFileWriter::SubmitFile(FilePath, Buffer.TakeBuffer());
+}
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <ostream>
+#include <mutex>
+#include <atomic>
+#include <unordered_map>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <condition_variable>
+#include <filesystem>
+
+#include "Enums.h"
+
+namespace fs = std::filesystem;
+
+
+/*
+* Writes generated files to disk and records a hash of every file in a manifest ('FileManifest.txt') inside of the root folder.
+*
+* With Settings::Generator::bOnlyWriteChangedFiles the previous output is kept. Files whose hash matches the previous manifest are
+* not rewritten and keep their modification time, files which are no longer generated are removed in End().
+*/
+class IncrementalFileWriter
+{
+private:
+	static constexpr const char* ManifestFileName = "FileManifest.txt";
+
+	/* Most generated files fit into this, bigger files grow the buffer which is then reused with the bigger capacity */
+	static constexpr size_t InitialBufferSize = 0x40000;
+
+private:
+	static inline fs::path RootFolder;
+
+	/* Path relative to RootFolder -> hash of the content */
+	static inline std::unordered_map<std::string, uint64> PreviousHashes;
+	static inline std::unordered_map<std::string, uint64> CurrentHashes;
+
+	/* Files are written from the package-generation threads */
+	static inline std::mutex HashesMutex;
+
+	static inline std::atomic<int32> NumFilesWritten = 0x0;
+	static inline std::atomic<int32> NumFilesSkipped = 0x0;
+
+	static inline std::atomic<uint64> NumBytesWritten = 0x0;
+	static inline std::atomic<uint64> IOTimeMicroseconds = 0x0;
+
+	/* Cleared buffers, which keep their capacity, to be reused by the next BufferedFileStream */
+	static inline std::vector<std::string> BufferPool;
+	static inline std::mutex BufferPoolMutex;
+
+	/* Files waiting to be written by the IOThread, only used with Settings::CppGenerator::bWriteFilesAsynchronously */
+	static inline std::deque<std::pair<fs::path, std::string>> PendingFiles;
+	static inline std::mutex PendingFilesMutex;
+	static inline std::condition_variable PendingFilesCondition;
+	static inline std::thread IOThread;
+	static inline bool bIsStopRequested = false;
+
+private:
+	static uint64 HashContent(std::string_view Content);
+
+	/* Path of 'FilePath' relative to RootFolder, UTF-8 encoded with '/' as seperator, as stored in the manifest */
+	static std::string GetRelativePath(const fs::path& FilePath);
+
+	static void LoadManifest();
+	static void SaveManifest();
+
+	static void ProcessPendingFiles();
+
+public:
+	/* Loads the manifest of the previous run from 'InRootFolder', if there is one */
+	static void Begin(const fs::path& InRootFolder);
+
+	/* Waits for pending writes, removes files which were part of the previous manifest but weren't written during this run, and writes the new manifest */
+	static void End();
+
+	/* Returns false if the file couldn't be written */
+	static bool WriteFile(const fs::path& FilePath, std::string_view Content);
+
+	/* Keeps a file from the previous run without writing it, returns false if the file isn't part of the previous manifest or doesn't exist anymore */
+	static bool KeepFile(const fs::path& FilePath);
+
+	/* Writes the file, or queues it to be written on the IOThread. 'Content' is returned to the BufferPool afterwards. */
+	static void SubmitFile(const fs::path& FilePath, std::string&& Content);
+
+	/* Returns an empty buffer with at least 'InitialBufferSize' bytes of capacity */
+	static std::string AcquireBuffer();
+	static void ReleaseBuffer(std::string&& Buffer);
+
+public:
+	static inline uint64 GetNumBytesWritten() { return NumBytesWritten; }
+
+	/* Time spent opening and writing files, summed up over all threads */
+	static inline double GetTimeSpentInIOMs() { return IOTimeMicroseconds / 1000.0; }
+};
+
+
+/* Appends everything written to it to a std::string, without the overhead of std::stringbuf */
+class StringStreamBuffer : public std::streambuf
+{
+private:
+	std::string Buffer;
+
+public:
+	StringStreamBuffer() = default;
+	StringStreamBuffer(std::string&& InBuffer);
+	StringStreamBuffer(StringStreamBuffer&& Other) noexcept;
+
+	StringStreamBuffer& operator=(StringStreamBuffer&& Other) noexcept;
+
+protected:
+	int_type overflow(int_type Char) override;
+	std::streamsize xsputn(const char* String, std::streamsize Count) override;
+
+public:
+	std::string_view GetView() const;
+
+	/* Moves the buffer out, leaving this StringStreamBuffer empty */
+	std::string TakeBuffer();
+};
+
+
+/* std::ostream collecting the file in a pooled buffer, the content is passed to IncrementalFileWriter::SubmitFile() on close() or destruction */
+class BufferedFileStream : public std::ostream
+{
+private:
+	StringStreamBuffer Buffer;
+
+	fs::path FilePath;
+	bool bIsOpen = false;
+
+public:
+	BufferedFileStream();
+	BufferedFileStream(const fs::path& InFilePath);
+
+	BufferedFileStream(BufferedFileStream&& Other) noexcept;
+
+	~BufferedFileStream();
+
+	BufferedFileStream& operator=(BufferedFileStream&& Other) noexcept;
+
+public:
+	/* Named like the std::ofstream functions, so this class can be used as a drop-in replacement */
+	bool is_open() const;
+	void close();
+};
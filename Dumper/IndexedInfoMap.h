@@ -0,0 +1,121 @@
+#pragma once
+
+#include <vector>
+#include <tuple>
+#include <utility>
+#include <stdexcept>
+
+#include "Enums.h"
+
+
+/*
+* Map from GObjects-index to an info-struct, used instead of std::unordered_map for the info-overrides of the managers.
+*
+* Infos are stored contiguously in insertion-order and found through a table of positions which is directly indexed by the GObjects-index.
+* The interface is a subset of std::unordered_map, elements are std::pair<const int32, InfoType>. Iteration-order is the insertion-order.
+*
+* Inserting an element invalidates references to other elements.
+*/
+template<typename InfoType>
+class IndexedInfoMap
+{
+public:
+	using value_type = std::pair<const int32, InfoType>;
+
+	using iterator = typename std::vector<value_type>::iterator;
+	using const_iterator = typename std::vector<value_type>::const_iterator;
+
+private:
+	static constexpr int32 InvalidPosition = -1;
+
+private:
+	/* GObjects-index -> position of the info in 'Infos', InvalidPosition if there's no info for this index */
+	std::vector<int32> Positions;
+
+	std::vector<value_type> Infos;
+
+private:
+	inline int32 GetPosition(int32 Index) const
+	{
+		if (Index < 0 || Index >= static_cast<int32>(Positions.size()))
+			return InvalidPosition;
+
+		return Positions[Index];
+	}
+
+public:
+	inline InfoType& operator[](int32 Index)
+	{
+		if (Index >= static_cast<int32>(Positions.size()))
+			Positions.resize(Index + 1, InvalidPosition);
+
+		int32& Position = Positions[Index];
+
+		if (Position == InvalidPosition)
+		{
+			Position = static_cast<int32>(Infos.size());
+			Infos.emplace_back(std::piecewise_construct, std::forward_as_tuple(Index), std::forward_as_tuple());
+		}
+
+		return Infos[Position].second;
+	}
+
+	inline InfoType& at(int32 Index)
+	{
+		const int32 Position = GetPosition(Index);
+
+		if (Position == InvalidPosition)
+			throw std::out_of_range("IndexedInfoMap::at: no info for this index");
+
+		return Infos[Position].second;
+	}
+
+	inline const InfoType& at(int32 Index) const
+	{
+		return const_cast<IndexedInfoMap*>(this)->at(Index);
+	}
+
+	inline iterator find(int32 Index)
+	{
+		const int32 Position = GetPosition(Index);
+
+		return Position != InvalidPosition ? Infos.begin() + Position : Infos.end();
+	}
+
+	inline const_iterator find(int32 Index) const
+	{
+		const int32 Position = GetPosition(Index);
+
+		return Position != InvalidPosition ? Infos.cbegin() + Position : Infos.cend();
+	}
+
+	inline bool contains(int32 Index) const
+	{
+		return GetPosition(Index) != InvalidPosition;
+	}
+
+	/* Reserves space for 'NumInfos' infos, the position-table grows to the highest inserted index on its own */
+	inline void reserve(size_t NumInfos)
+	{
+		Infos.reserve(NumInfos);
+	}
+
+	inline void clear()
+	{
+		Positions.clear();
+		Infos.clear();
+	}
+
+	inline size_t size() const { return Infos.size(); }
+	inline bool empty() const { return Infos.empty(); }
+
+public:
+	inline iterator begin() { return Infos.begin(); }
+	inline iterator end() { return Infos.end(); }
+
+	inline const_iterator begin() const { return Infos.cbegin(); }
+	inline const_iterator end() const { return Infos.cend(); }
+
+	inline const_iterator cbegin() const { return Infos.cbegin(); }
+	inline const_iterator cend() const { return Infos.cend(); }
+};
@@ -7,6 +7,8 @@
 
 #include <iostream>
 #include <string>
+#include <thread>
+#include <chrono>
 
 EMappingsTypeFlags MappingGenerator::GetMappingType(UEProperty Property)
 {
@@ -130,32 +132,38 @@ EMappingsTypeFlags MappingGenerator::GetMappingType(UEProperty Property)
 	return EMappingsTypeFlags::Unknown;
 }
 
-int32 MappingGenerator::AddNameToData(std::stringstream& NameTable, const std::string& Name)
+int32 MappingGenerator::AddNameToData(WriteBuffer& NameTable, std::string_view Name)
 {
 	if constexpr (Settings::MappingGenerator::bShouldCheckForDuplicatedNames)
 	{
-		static std::unordered_map<std::string, int32> NameMap;
-		
-		auto [It, bInserted] = NameMap.insert({ Name, NameCounter });
+		/* Transparent, so names can be looked up by their string_view without constructing a std::string */
+		struct NameHash
+		{
+			using is_transparent = void;
+
+			inline size_t operator()(std::string_view Str) const { return std::hash<std::string_view>{}(Str); }
+		};
+
+		static std::unordered_map<std::string, int32, NameHash, std::equal_to<>> NameMap;
+
+		if (auto It = NameMap.find(Name); It != NameMap.end())
+			return It->second;
 
 		/* The name didn't occure yet, write it to the NameTable */
-		if (bInserted)
-		{
-			WriteToStream(NameTable, static_cast<uint16>(Name.length()));
-			NameTable.write(Name.c_str(), Name.length());
-			return NameCounter++;
-		}
+		NameMap.emplace(Name, NameCounter);
 
-		return It->second;
+		WriteToStream(NameTable, static_cast<uint16>(Name.length()));
+		NameTable.Write(Name.data(), Name.length());
+		return NameCounter++;
 	}
 
 	WriteToStream(NameTable, static_cast<uint16>(Name.length()));
-	NameTable.write(Name.c_str(), Name.length());
+	NameTable.Write(Name.data(), Name.length());
 
 	return NameCounter++;
 }
 
-void MappingGenerator::GeneratePropertyType(UEProperty Property, std::stringstream& Data, std::stringstream& NameTable)
+void MappingGenerator::GeneratePropertyType(UEProperty Property, WriteBuffer& Data, WriteBuffer& NameTable)
 {
 	if (!Property)
 	{
@@ -178,17 +186,17 @@ void MappingGenerator::GeneratePropertyType(UEProperty Property, std::stringstre
 	{
 		GeneratePropertyType(Property.Cast<UEEnumProperty>().GetUnderlayingProperty(), Data, NameTable);
 
-		const int32 EnumNameIdx = AddNameToData(NameTable, Property.Cast<UEEnumProperty>().GetEnum().GetName());
+		const int32 EnumNameIdx = AddNameToData(NameTable, Property.Cast<UEEnumProperty>().GetEnum().GetNameView());
 		WriteToStream(Data, EnumNameIdx);
 	}
 	else if (bIsFakeEnumProperty)
 	{
-		const int32 EnumNameIdx = AddNameToData(NameTable, Property.Cast<UEByteProperty>().GetEnum().GetName());
+		const int32 EnumNameIdx = AddNameToData(NameTable, Property.Cast<UEByteProperty>().GetEnum().GetNameView());
 		WriteToStream(Data, EnumNameIdx);
 	}
 	else if (MappingType == EMappingsTypeFlags::StructProperty)
 	{
-		const int32 StructNameIdx = AddNameToData(NameTable, Property.Cast<UEStructProperty>().GetUnderlayingStruct().GetName());
+		const int32 StructNameIdx = AddNameToData(NameTable, Property.Cast<UEStructProperty>().GetUnderlayingStruct().GetNameView());
 		WriteToStream(Data, StructNameIdx);
 	}
 	else if (MappingType == EMappingsTypeFlags::SetProperty)
@@ -211,7 +219,7 @@ void MappingGenerator::GeneratePropertyType(UEProperty Property, std::stringstre
 	}
 }
 
-void MappingGenerator::GeneratePropertyInfo(const PropertyWrapper& Property, std::stringstream& Data, std::stringstream& NameTable, int32& Index)
+void MappingGenerator::GeneratePropertyInfo(const PropertyWrapper& Property, WriteBuffer& Data, WriteBuffer& NameTable, int32& Index)
 {
 	if (!Property.IsUnrealProperty())
 	{
@@ -222,7 +230,7 @@ void MappingGenerator::GeneratePropertyInfo(const PropertyWrapper& Property, std
 	WriteToStream(Data, static_cast<uint16>(Index));
 	WriteToStream(Data, static_cast<uint8>(Property.GetArrayDim()));
 
-	const int32 MemberNameIdx = AddNameToData(NameTable, Property.GetUnrealProperty().GetName());
+	const int32 MemberNameIdx = AddNameToData(NameTable, Property.GetUnrealProperty().GetNameView());
 	WriteToStream(Data, MemberNameIdx);
 
 	GeneratePropertyType(Property.GetUnrealProperty(), Data, NameTable);
@@ -230,7 +238,7 @@ void MappingGenerator::GeneratePropertyInfo(const PropertyWrapper& Property, std
 	Index += Property.GetArrayDim();
 }
 
-void MappingGenerator::GenerateStruct(const StructWrapper& Struct, std::stringstream& Data, std::stringstream& NameTable)
+void MappingGenerator::GenerateStruct(const StructWrapper& Struct, WriteBuffer& Data, WriteBuffer& NameTable)
 {
 	if (!Struct.IsValid())
 		return;
@@ -282,7 +290,7 @@ void MappingGenerator::GenerateStruct(const StructWrapper& Struct, std::stringst
 	}
 }
 
-void MappingGenerator::GenerateEnum(const EnumWrapper& Enum, std::stringstream& Data, std::stringstream& NameTable)
+void MappingGenerator::GenerateEnum(const EnumWrapper& Enum, WriteBuffer& Data, WriteBuffer& NameTable)
 {
 	const int32 EnumNameIndex = AddNameToData(NameTable, Enum.GetRawName());
 	WriteToStream(Data, EnumNameIndex);
@@ -297,15 +305,17 @@ void MappingGenerator::GenerateEnum(const EnumWrapper& Enum, std::stringstream&
 }
 
 
-std::stringstream MappingGenerator::GenerateFileData()
+void MappingGenerator::GenerateFileData(WriteBuffer& OutNameTable, WriteBuffer& OutEnumsAndStructs)
 {
-	std::stringstream NameData;
-	std::stringstream StructData;
-	std::stringstream EnumData;
-
 	uint32 NumEnums = 0x0;
 	uint32 NumStructsAndClasse = 0x0;
 
+	/* Counts are written as placeholders and patched once the respective section is complete */
+	WriteToStream(OutNameTable, static_cast<uint32>(0x0));
+
+	const size_t NumEnumsOffset = OutEnumsAndStructs.Size();
+	WriteToStream(OutEnumsAndStructs, static_cast<uint32>(0x0));
+
 	/* Handle all Enums first */
 	for (PackageInfoHandle Package : PackageManager::IterateOverPackageInfos())
 	{
@@ -318,10 +328,13 @@ std::stringstream MappingGenerator::GenerateFileData()
 
 		for (int32 EnumIdx : Package.GetEnums())
 		{
-			GenerateEnum(ObjectArray::GetByIndex<UEEnum>(EnumIdx), EnumData, NameData);
+			GenerateEnum(ObjectArray::GetByIndex<UEEnum>(EnumIdx), OutEnumsAndStructs, OutNameTable);
 			NumEnums++;
 		}
 	}
+
+	const size_t NumStructsOffset = OutEnumsAndStructs.Size();
+	WriteToStream(OutEnumsAndStructs, static_cast<uint32>(0x0));
 	
 	/* Handle all structs and classes in one go. From the mapping-files point of view classes are the exact same as structs. */
 	for (PackageInfoHandle Package : PackageManager::IterateOverPackageInfos())
@@ -333,9 +346,9 @@ std::stringstream MappingGenerator::GenerateFileData()
 		if (!Package.HasClasses() && !Package.HasStructs())
 			continue;
 
-		DependencyManager::OnVisitCallbackType GenerateStructCallback = [&](int32 Index) -> void
+		auto GenerateStructCallback = [&](int32 Index) -> void
 		{
-			GenerateStruct(ObjectArray::GetByIndex<UEStruct>(Index), StructData, NameData);
+			GenerateStruct(ObjectArray::GetByIndex<UEStruct>(Index), OutEnumsAndStructs, OutNameTable);
 			NumStructsAndClasse++;
 		};
 
@@ -352,35 +365,100 @@ std::stringstream MappingGenerator::GenerateFileData()
 		}
 	}
 
-	/* Combine all of the stringstreams into one Data block representing the entire payload of the file */
-	std::stringstream ReturnBuffer;
-
-	/* Write Name-count and names */
-	WriteToStream(ReturnBuffer, static_cast<uint32>(NameCounter));
-	WriteToStream(ReturnBuffer, NameData);
+	/* Write Name-count, Enum-count and Struct-count */
+	OutNameTable.Patch(0x0, static_cast<uint32>(NameCounter));
+	OutEnumsAndStructs.Patch(NumEnumsOffset, NumEnums);
+	OutEnumsAndStructs.Patch(NumStructsOffset, NumStructsAndClasse);
 
 	if constexpr (Settings::Debug::bShouldPrintMappingDebugData)
+	{
 		std::cout << std::format("MappingGeneration: NameCounter = 0x{0:X} (Dec: {0})\n", static_cast<uint32>(NameCounter));
+		std::cout << std::format("MappingGeneration: NumEnums = 0x{0:X} (Dec: {0})\n", static_cast<uint32>(NumEnums));
+		std::cout << std::format("MappingGeneration: NumStructsAndClasse = 0x{0:X} (Dec: {0})\n\n", static_cast<uint32>(NumStructsAndClasse));
+	}
+}
 
-	/* Write Enum-count and enums */
-	WriteToStream(ReturnBuffer, static_cast<uint32>(NumEnums));
-	WriteToStream(ReturnBuffer, EnumData);
 
-	if constexpr (Settings::Debug::bShouldPrintMappingDebugData)
-		std::cout << std::format("MappingGeneration: NumEnums = 0x{0:X} (Dec: {0})\n", static_cast<uint32>(NumEnums));
+size_t MappingGenerator::CompressWithZStandard(const WriteBuffer& NameTable, const WriteBuffer& EnumsAndStructs, void* OutBuffer, size_t OutBufferSize, int32 CompressionLevel)
+{
+	const int32 NumThreads = Settings::MappingGenerator::NumCompressionThreads > 0 ? Settings::MappingGenerator::NumCompressionThreads : static_cast<int32>(std::thread::hardware_concurrency());
+	const int32 WindowLog = Settings::MappingGenerator::LongDistanceMatchingWindowLog;
 
-	/* Write Struct-count and enums */
-	WriteToStream(ReturnBuffer, static_cast<uint32>(NumStructsAndClasse));
-	WriteToStream(ReturnBuffer, StructData);
+	ZSTD_CCtx* Context = ZSTD_createCCtx();
+	ZSTD_CCtx_setParameter(Context, ZSTD_c_compressionLevel, CompressionLevel);
+	ZSTD_CCtx_setPledgedSrcSize(Context, NameTable.Size() + EnumsAndStructs.Size());
 
-	if constexpr (Settings::Debug::bShouldPrintMappingDebugData)
-		std::cout << std::format("MappingGeneration: NumStructsAndClasse = 0x{0:X} (Dec: {0})\n\n", static_cast<uint32>(NumStructsAndClasse));
+	/* 'nbWorkers == 0' compresses on the calling thread, any other value spawns that many worker-threads */
+	if (NumThreads > 1)
+		ZSTD_CCtx_setParameter(Context, ZSTD_c_nbWorkers, NumThreads);
+
+	if (WindowLog > 0)
+	{
+		ZSTD_CCtx_setParameter(Context, ZSTD_c_enableLongDistanceMatching, 1);
+		ZSTD_CCtx_setParameter(Context, ZSTD_c_windowLog, WindowLog);
+	}
+
+	ZSTD_outBuffer Output = { OutBuffer, OutBufferSize, 0x0 };
+
+	/* Both parts of the payload are fed to zstd directly. With workers, zstd might not consume all input in a single call. */
+	ZSTD_inBuffer NameTableInput = { NameTable.GetData(), NameTable.Size(), 0x0 };
 
-	return ReturnBuffer;
+	size_t Result = 0x0;
+	while (NameTableInput.pos < NameTableInput.size && !ZSTD_isError(Result))
+		Result = ZSTD_compressStream2(Context, &Output, &NameTableInput, ZSTD_e_continue);
+
+	ZSTD_inBuffer EnumsAndStructsInput = { EnumsAndStructs.GetData(), EnumsAndStructs.Size(), 0x0 };
+
+	/* ZSTD_e_end returns the number of bytes left to flush, 0 once the frame is complete */
+	do
+	{
+		if (ZSTD_isError(Result))
+			break;
+
+		Result = ZSTD_compressStream2(Context, &Output, &EnumsAndStructsInput, ZSTD_e_end);
+	}
+	while (Result != 0x0);
+
+	ZSTD_freeCCtx(Context);
+
+	if (ZSTD_isError(Result))
+	{
+		std::cout << std::format("MappingGeneration: zstd compression failed with \"{}\"!\n", ZSTD_getErrorName(Result)) << std::endl;
+		return 0x0;
+	}
+
+	return Output.pos;
 }
 
+void MappingGenerator::BenchmarkCompression(const WriteBuffer& NameTable, const WriteBuffer& EnumsAndStructs)
+{
+	const size_t UncompressedSize = NameTable.Size() + EnumsAndStructs.Size();
+	const size_t CompressedBufferSize = ZSTD_compressBound(UncompressedSize);
+
+	void* CompressedBuffer = malloc(CompressedBufferSize);
+
+	std::cout << std::format("MappingGeneration: Benchmarking zstd on 0x{0:X} (Dec: {0}) bytes, {1} threads, WindowLog {2}\n", UncompressedSize, Settings::MappingGenerator::NumCompressionThreads, Settings::MappingGenerator::LongDistanceMatchingWindowLog);
+
+	for (int32 Level = 1; Level <= ZSTD_maxCLevel(); Level++)
+	{
+		const auto StartTime = std::chrono::high_resolution_clock::now();
+
+		const size_t CompressedSize = CompressWithZStandard(NameTable, EnumsAndStructs, CompressedBuffer, CompressedBufferSize, Level);
+
+		const std::chrono::duration<double, std::milli> Duration = std::chrono::high_resolution_clock::now() - StartTime;
+
+		if (CompressedSize == 0x0)
+			continue;
+
+		std::cout << std::format("Level {:2}: {:10} bytes, ratio {:6.2f}, {:10.2f}ms\n", Level, CompressedSize, static_cast<double>(UncompressedSize) / CompressedSize, Duration.count());
+	}
+
+	std::cout << std::endl;
+
+	free(CompressedBuffer);
+}
 
-void MappingGenerator::GenerateFileHeader(StreamType& InUsmap, const std::stringstream& Data)
+void MappingGenerator::GenerateFileHeader(StreamType& InUsmap, const WriteBuffer& NameTable, const WriteBuffer& EnumsAndStructs)
 {
 	/* Write 2bytes unsigned */
 	WriteToStream(InUsmap, UsmapFileMagic);
@@ -391,29 +469,34 @@ void MappingGenerator::GenerateFileHeader(StreamType& InUsmap, const std::string
 	/* We're on 'LargeEnums' version, we need to write 'bool' (aka int32) bHasVersioning. (NoVersioning = false) -> no [int32 UE4Version, int32 UE5Version] and no [uint32 NetCL] */
 	WriteToStream(InUsmap, static_cast<int32>(false));
 
-	const uint32 UncompressedSize = static_cast<uint32>(Data.str().length());
+	const uint32 UncompressedSize = static_cast<uint32>(NameTable.Size() + EnumsAndStructs.Size());
 
-	constexpr auto CompressionMethod = Settings::MappingGenerator::CompressionMethod;
-
-	/* Write 'CompressionMethod' to the compression byte */
-	WriteToStream(InUsmap, static_cast<uint8>(CompressionMethod));
+	EUsmapCompressionMethod CompressionMethod = Settings::MappingGenerator::CompressionMethod;
 
 	size_t CompressedSize = UncompressedSize;
 	void* CompressedBuffer = nullptr;
 
-	switch (CompressionMethod)
+	if (CompressionMethod == EUsmapCompressionMethod::ZStandard)
 	{
-	case EUsmapCompressionMethod::ZStandard:
-		CompressedSize = ZSTD_compressBound(UncompressedSize);
-		CompressedBuffer = malloc(CompressedSize);
-		CompressedSize = ZSTD_compress(CompressedBuffer, CompressedSize, Data.str().data(), UncompressedSize, ZSTD_maxCLevel());
-		break;
-	default:
-		CompressedBuffer = malloc(CompressedSize);
-		memcpy(CompressedBuffer, Data.str().data(), CompressedSize);
-		break;
+		const size_t CompressedBufferSize = ZSTD_compressBound(UncompressedSize);
+		CompressedBuffer = malloc(CompressedBufferSize);
+
+		CompressedSize = CompressWithZStandard(NameTable, EnumsAndStructs, CompressedBuffer, CompressedBufferSize, Settings::MappingGenerator::CompressionLevel);
+
+		/* Fall back to an uncompressed payload */
+		if (CompressedSize == 0x0)
+		{
+			free(CompressedBuffer);
+			CompressedBuffer = nullptr;
+
+			CompressionMethod = EUsmapCompressionMethod::None;
+			CompressedSize = UncompressedSize;
+		}
 	}
 
+	/* Write 'CompressionMethod' to the compression byte */
+	WriteToStream(InUsmap, static_cast<uint8>(CompressionMethod));
+
 	if constexpr (Settings::Debug::bShouldPrintMappingDebugData)
 	{
 		std::cout << std::format("MappingGeneration: CompressedSize = 0x{0:X} (Dec: {0})\n", CompressedSize);
@@ -427,9 +510,15 @@ void MappingGenerator::GenerateFileHeader(StreamType& InUsmap, const std::string
 	WriteToStream(InUsmap, UncompressedSize);
 
 	/* Header is done, now write the payload to the file */
-	InUsmap.write(static_cast<const char*>(CompressedBuffer), static_cast<uint32>(CompressedSize));
+	if (CompressedBuffer)
+	{
+		InUsmap.write(static_cast<const char*>(CompressedBuffer), static_cast<uint32>(CompressedSize));
+		free(CompressedBuffer);
+		return;
+	}
 
-	free(CompressedBuffer);
+	InUsmap.write(reinterpret_cast<const char*>(NameTable.GetData()), NameTable.Size());
+	InUsmap.write(reinterpret_cast<const char*>(EnumsAndStructs.GetData()), EnumsAndStructs.Size());
 }
 
 void MappingGenerator::Generate()
@@ -443,10 +532,18 @@ void MappingGenerator::Generate()
 	/* Open the stream as binary data, else ofstream will add \r after numbers that can be interpreted as \n. */
 	std::ofstream UsmapFile(MainFolder / MappingsFileName, std::ios::binary);
 
+	WriteBuffer NameTable;
+	WriteBuffer EnumsAndStructs;
+	NameTable.Reserve(0x400000);
+	EnumsAndStructs.Reserve(0x1000000);
+
 	/* Generate the payload of the file, containing all of the names, enums and structs. */
-	std::stringstream FileData = GenerateFileData();
+	GenerateFileData(NameTable, EnumsAndStructs);
 
 	/* Generate the header, and write both header and payload into the file. */
-	GenerateFileHeader(UsmapFile, FileData);
+	GenerateFileHeader(UsmapFile, NameTable, EnumsAndStructs);
+
+	if constexpr (Settings::Debug::bBenchmarkMappingCompression)
+		BenchmarkCompression(NameTable, EnumsAndStructs);
 }
 
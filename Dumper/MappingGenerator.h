@@ -4,6 +4,8 @@
 #include "EnumWrapper.h"
 
 #include <fstream>
+#include <vector>
+#include <cstring>
 
 /*
 * USMAP-Header:
@@ -82,6 +84,32 @@ private:
         LatestPlusOne,
     };
 
+    /* Contiguous, growable buffer the usmap-sections are serialized into. Handed to zstd by pointer, without any intermediate copies. */
+    class WriteBuffer
+    {
+    private:
+        std::vector<uint8> Data;
+
+    public:
+        inline void Write(const void* Bytes, size_t Size)
+        {
+            const uint8* BytesAsUint8 = static_cast<const uint8*>(Bytes);
+            Data.insert(Data.end(), BytesAsUint8, BytesAsUint8 + Size);
+        }
+
+        /* Overwrites previously written data, used to fill in counts which are only known after a section was written */
+        template<typename T>
+        inline void Patch(size_t Offset, T Value)
+        {
+            memcpy(Data.data() + Offset, &Value, sizeof(T));
+        }
+
+        inline void Reserve(size_t Size) { Data.reserve(Size); }
+
+        inline size_t Size() const { return Data.size(); }
+        inline const uint8* GetData() const { return Data.data(); }
+    };
+
 private:
     static constexpr uint16 UsmapFileMagic = 0x30C4;
 
@@ -104,26 +132,32 @@ private:
         InStream.write(reinterpret_cast<const char*>(&Value), sizeof(T));
     }
 
-    template<typename InStreamType>
-    static void WriteToStream(InStreamType& InStream, const std::stringstream& Data)
+    template<typename T>
+    static void WriteToStream(WriteBuffer& InBuffer, T Value)
     {
-        InStream << Data.rdbuf();
+        InBuffer.Write(&Value, sizeof(T));
     }
 
 private:
     /* Utility Functions */
     static EMappingsTypeFlags GetMappingType(UEProperty Property);
-    static int32 AddNameToData(std::stringstream& NameTable, const std::string& Name);
+    static int32 AddNameToData(WriteBuffer& NameTable, std::string_view Name);
 
 private:
-    static void GeneratePropertyType(UEProperty Property, std::stringstream& Data, std::stringstream& NameTable);
-    static void GeneratePropertyInfo(const PropertyWrapper& Property, std::stringstream& Data, std::stringstream& NameTable, int32& Index);
+    static void GeneratePropertyType(UEProperty Property, WriteBuffer& Data, WriteBuffer& NameTable);
+    static void GeneratePropertyInfo(const PropertyWrapper& Property, WriteBuffer& Data, WriteBuffer& NameTable, int32& Index);
+
+    static void GenerateStruct(const StructWrapper& Struct, WriteBuffer& Data, WriteBuffer& NameTable);
+    static void GenerateEnum(const EnumWrapper& Enum, WriteBuffer& Data, WriteBuffer& NameTable);
+
+    /* The payload is split into the name-table and everything following it, as names are only known after all enums and structs were written */
+    static void GenerateFileData(WriteBuffer& OutNameTable, WriteBuffer& OutEnumsAndStructs);
+    static void GenerateFileHeader(StreamType& InUsmap, const WriteBuffer& NameTable, const WriteBuffer& EnumsAndStructs);
 
-    static void GenerateStruct(const StructWrapper& Struct, std::stringstream& Data, std::stringstream& NameTable);
-    static void GenerateEnum(const EnumWrapper& Enum, std::stringstream& Data, std::stringstream& NameTable);
+    /* Compresses the payload using the settings in Settings::MappingGenerator. Returns the compressed size, or 0 on failure. */
+    static size_t CompressWithZStandard(const WriteBuffer& NameTable, const WriteBuffer& EnumsAndStructs, void* OutBuffer, size_t OutBufferSize, int32 CompressionLevel);
 
-    static std::stringstream GenerateFileData();
-    static void GenerateFileHeader(StreamType& InUsmap, const std::stringstream& Data);
+    static void BenchmarkCompression(const WriteBuffer& NameTable, const WriteBuffer& EnumsAndStructs);
 
 public:
     static void Generate();
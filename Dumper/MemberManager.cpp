@@ -65,11 +65,11 @@ bool MemberManager::HasMembers() const
 
 MemberIterator<true> MemberManager::IterateMembers() const
 {
-	return MemberIterator<true>(Struct, Members, PredefMembers);
+	return MemberIterator<true>(Struct.get(), Members, PredefMembers);
 }
 
 FunctionIterator<true> MemberManager::IterateFunctions() const
 {
-	return FunctionIterator<true>(Struct, Functions, PredefFunctions);
+	return FunctionIterator<true>(Struct.get(), Functions, PredefFunctions);
 }
 
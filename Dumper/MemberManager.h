@@ -1,6 +1,7 @@
 #pragma once
 #include <unordered_map>
 #include <memory>
+#include <mutex>
 #include "ObjectArray.h"
 #include "HashStringTable.h"
 #include "CollisionManager.h"
@@ -15,7 +16,8 @@ private:
 	using DereferenceType = std::conditional_t<bIsDeferredTemplateCreation, class PropertyWrapper, void>;
 
 private:
-	const std::shared_ptr<class StructWrapper> Struct;
+	/* Owned by the MemberManager this iterator was created from */
+	const class StructWrapper* Struct;
 
 	const std::vector<UEProperty>& Members;
 	const std::vector<PredefType>* PredefElements;
@@ -26,7 +28,7 @@ private:
 	bool bIsCurrentlyPredefined = true;
 
 public:
-	inline MemberIterator(const std::shared_ptr<class StructWrapper>& Str, const std::vector<UEProperty>& Mbr, const std::vector<PredefType>* const Predefs = nullptr, int32 StartIdx = 0x0, int32 PredefStart = 0x0)
+	inline MemberIterator(const class StructWrapper* Str, const std::vector<UEProperty>& Mbr, const std::vector<PredefType>* const Predefs = nullptr, int32 StartIdx = 0x0, int32 PredefStart = 0x0)
 		: Struct(Str), Members(Mbr), PredefElements(Predefs), CurrentIdx(StartIdx), CurrentPredefIdx(PredefStart)
 	{
 		const int32 NextUnrealOffset = GetUnrealMemberOffset();
@@ -86,7 +88,8 @@ private:
 	using DereferenceType = std::conditional_t<bIsDeferredTemplateCreation, class FunctionWrapper, void> ;
 
 private:
-	const std::shared_ptr<StructWrapper> Struct;
+	/* Owned by the MemberManager this iterator was created from */
+	const StructWrapper* Struct;
 
 	const std::vector<UEFunction>& Members;
 	const std::vector<PredefType>* PredefElements;
@@ -97,7 +100,7 @@ private:
 	bool bIsCurrentlyPredefined = true;
 
 public:
-	inline FunctionIterator(const std::shared_ptr<StructWrapper>& Str, const std::vector<UEFunction>& Mbr, const std::vector<PredefType>* const Predefs = nullptr, int32 StartIdx = 0x0, int32 PredefStart = 0x0)
+	inline FunctionIterator(const StructWrapper* Str, const std::vector<UEFunction>& Mbr, const std::vector<PredefType>* const Predefs = nullptr, int32 StartIdx = 0x0, int32 PredefStart = 0x0)
 		: Struct(Str), Members(Mbr), PredefElements(Predefs), CurrentIdx(StartIdx), CurrentPredefIdx(PredefStart)
 	{
 		bIsCurrentlyPredefined = bShouldNextMemberBePredefined();
@@ -178,13 +181,14 @@ private:
 	friend class CollisionManagerTest;
 
 private:
-	/* Map to lookup if a struct has predefined members */
-	static inline const PredefinedMemberLookupMapType* PredefinedMemberLookup = nullptr;
+	/* Map to lookup if a struct has predefined members. Per thread, as generators can run concurrently. */
+	static inline thread_local const PredefinedMemberLookupMapType* PredefinedMemberLookup = nullptr;
 
 	/* CollisionManager containing information on colliding member-/function-names */
 	static inline CollisionManager MemberNames;
 
 private:
+	/* Iterators and the wrappers they return only reference this StructWrapper, so the MemberManager needs to outlive them */
 	const std::shared_ptr<StructWrapper> Struct;
 
 	std::vector<UEProperty> Members;
@@ -280,24 +284,23 @@ public:
 
 	static inline void Init()
 	{
-		static bool bInitialized = false;
-
-		if (bInitialized)
-			return;
-
-		bInitialized = true;
+		/* Runs on the init task-graph, concurrent callers wait until the first one finished initializing */
+		static std::once_flag InitFlag;
 
-		/* Adds special names first, to avoid name-collisions with predefined members */
-		InitReservedNames();
-
-		/* Initialize member-name collisions  */
-		for (auto Obj : ObjectArray())
+		std::call_once(InitFlag, []() -> void
 		{
-			if (!Obj.IsA(EClassCastFlags::Struct) || Obj.IsA(EClassCastFlags::Function))
-				continue;
-
-			AddStructToNameContainer(Obj.Cast<UEStruct>());
-		}
+			/* Adds special names first, to avoid name-collisions with predefined members */
+			InitReservedNames();
+
+			/* Initialize member-name collisions  */
+			for (auto Obj : ObjectArray())
+			{
+				if (!Obj.IsA(EClassCastFlags::Struct) || Obj.IsA(EClassCastFlags::Function))
+					continue;
+
+				AddStructToNameContainer(Obj.Cast<UEStruct>());
+			}
+		});
 	}
 
 	static inline void AddStructToNameContainer(UEStruct Struct)
@@ -1,5 +1,6 @@
 #pragma once
 #include <unordered_set>
+#include <chrono>
 #include "MemberManager.h"
 #include "MemberWrappers.h"
 #include "TestBase.h"
@@ -19,6 +20,7 @@ public:
 		TestInit<bDoDebugPrinting>();
 		TestMemberIterator<bDoDebugPrinting>();
 		TestFunctionIterator<bDoDebugPrinting>();
+		TestIterationSpeed<bDoDebugPrinting>();
 
 		PrintDbgMessage<bDoDebugPrinting>("");
 	}
@@ -99,6 +101,9 @@ public:
 			//PrintDbgMessage<bDoDebugPrinting>("{} {}; // 0x{:04X}, 0x:{04X}", Wrapper.IsUnrealProperty() ? Wrapper.GetUnrealProperty().GetCppType() : Wrapper.GetType(), Wrapper.GetName(), Wrapper.GetOffset(), Wrapper.GetSize());
 		}
 
+		/* The lookup is thread_local and would outlive 'PredefinedMembers' */
+		MemberManager::SetPredefinedMemberLookupPtr(nullptr);
+
 		std::cout << __FUNCTION__ << ": " << (bSuccededTestWithoutError ? "SUCCEEDED!" : "FAILED!") << std::endl;
 	}
 
@@ -233,6 +238,78 @@ public:
 			PrintDbgMessage<bDoDebugPrinting>("Func: {};", Wrapper.GetName());
 		}
 
+		/* The lookup is thread_local and would outlive 'PredefinedMembers' */
+		MemberManager::SetPredefinedMemberLookupPtr(nullptr);
+
+		std::cout << __FUNCTION__ << ": " << (bSuccededTestWithoutError ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
+	/* Microbenchmark, iterates the members and functions of all structs and classes through their wrappers and compares them to iterating the reflection data directly */
+	template<bool bDoDebugPrinting = false>
+	static inline void TestIterationSpeed()
+	{
+		MemberManager::Init();
+		StructManager::Init();
+
+		/* Without predefined members the wrappers visit exactly the properties and functions of the struct */
+		MemberManager::SetPredefinedMemberLookupPtr(nullptr);
+
+		struct IterationResult
+		{
+			int64 OffsetSum = 0x0;
+			int32 NumMembers = 0x0;
+			int32 NumFunctions = 0x0;
+
+			inline bool operator==(const IterationResult& Other) const = default;
+		};
+
+		IterationResult WrapperResult;
+		IterationResult DirectResult;
+
+		const auto WrapperStartTime = std::chrono::high_resolution_clock::now();
+
+		for (UEObject Obj : ObjectArray())
+		{
+			if (!Obj.IsA(EClassCastFlags::Struct) || Obj.IsA(EClassCastFlags::Function))
+				continue;
+
+			MemberManager Members(Obj.Cast<UEStruct>());
+
+			for (const PropertyWrapper& Wrapper : Members.IterateMembers())
+			{
+				WrapperResult.OffsetSum += Wrapper.GetOffset();
+				WrapperResult.NumMembers++;
+			}
+
+			for (const FunctionWrapper& Wrapper : Members.IterateFunctions())
+				WrapperResult.NumFunctions++;
+		}
+
+		const std::chrono::duration<double, std::milli> WrapperDuration = std::chrono::high_resolution_clock::now() - WrapperStartTime;
+
+		const auto DirectStartTime = std::chrono::high_resolution_clock::now();
+
+		for (UEObject Obj : ObjectArray())
+		{
+			if (!Obj.IsA(EClassCastFlags::Struct) || Obj.IsA(EClassCastFlags::Function))
+				continue;
+
+			const UEStruct Struct = Obj.Cast<UEStruct>();
+
+			for (const UEProperty Property : Struct.GetProperties())
+			{
+				DirectResult.OffsetSum += Property.GetOffset();
+				DirectResult.NumMembers++;
+			}
+
+			DirectResult.NumFunctions += static_cast<int32>(Struct.GetFunctions().size());
+		}
+
+		const std::chrono::duration<double, std::milli> DirectDuration = std::chrono::high_resolution_clock::now() - DirectStartTime;
+
+		const bool bSuccededTestWithoutError = WrapperResult == DirectResult;
+
+		PrintDbgMessage<bDoDebugPrinting>("{} --> 0x{:X} members and 0x{:X} functions, wrappers: {:.2f}ms, reflection data: {:.2f}ms", __FUNCTION__, WrapperResult.NumMembers, WrapperResult.NumFunctions, WrapperDuration.count(), DirectDuration.count());
 		std::cout << __FUNCTION__ << ": " << (bSuccededTestWithoutError ? "SUCCEEDED!" : "FAILED!") << std::endl;
 	}
-};
\ No newline at end of file
+};
@@ -1,12 +1,19 @@
+#include <type_traits>
+
 #include "MemberWrappers.h"
 
 
-PropertyWrapper::PropertyWrapper(const std::shared_ptr<StructWrapper>& Str, const PredefinedMember* Predef)
+/* Wrappers are created for every member during iteration, copying them shouldn't do more than copying their bytes */
+static_assert(std::is_trivially_copyable_v<PropertyWrapper>, "PropertyWrapper is expected to be trivially copyable!");
+static_assert(std::is_trivially_copyable_v<FunctionWrapper>, "FunctionWrapper is expected to be trivially copyable!");
+
+
+PropertyWrapper::PropertyWrapper(const StructWrapper* Str, const PredefinedMember* Predef)
     : PredefProperty(Predef), Struct(Str), Name()
 {
 }
 
-PropertyWrapper::PropertyWrapper(const std::shared_ptr<StructWrapper>& Str, UEProperty Prop)
+PropertyWrapper::PropertyWrapper(const StructWrapper* Str, UEProperty Prop)
     : Property(Prop), Name(MemberManager::GetNameCollisionInfo(Str->GetUnrealStruct(), Prop)), Struct(Str), bIsUnrealProperty(true)
 {
 }
@@ -160,12 +167,12 @@ bool PropertyWrapper::IsZeroSizedMember() const
 }
 
 
-FunctionWrapper::FunctionWrapper(const std::shared_ptr<StructWrapper>& Str, const PredefinedFunction* Predef)
+FunctionWrapper::FunctionWrapper(const StructWrapper* Str, const PredefinedFunction* Predef)
     : PredefFunction(Predef), Struct(Str), Name()
 {
 }
 
-FunctionWrapper::FunctionWrapper(const std::shared_ptr<StructWrapper>& Str, UEFunction Func)
+FunctionWrapper::FunctionWrapper(const StructWrapper* Str, UEFunction Func)
     : Function(Func), Name(Str ? MemberManager::GetNameCollisionInfo(Str->GetUnrealStruct(), Func) : NameInfo()), Struct(Str), bIsUnrealFunction(true)
 {
 }
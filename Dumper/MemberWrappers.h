@@ -13,7 +13,8 @@ private:
         const PredefinedMember* PredefProperty;
     };
 
-    const std::shared_ptr<StructWrapper> Struct;
+    /* Non-owning, the StructWrapper is kept alive by the MemberManager this property was retrieved from */
+    const StructWrapper* Struct;
 
     NameInfo Name;
 
@@ -22,9 +23,9 @@ private:
 public:
     PropertyWrapper(const PropertyWrapper&) = default;
 
-    PropertyWrapper(const std::shared_ptr<StructWrapper>& Str, const PredefinedMember* Predef);
+    PropertyWrapper(const StructWrapper* Str, const PredefinedMember* Predef);
 
-    PropertyWrapper(const std::shared_ptr<StructWrapper>& Str, UEProperty Prop);
+    PropertyWrapper(const StructWrapper* Str, UEProperty Prop);
 
 public:
     std::string GetName() const;
@@ -84,16 +85,17 @@ private:
         const PredefinedFunction* PredefFunction;
     };
 
-    const std::shared_ptr<StructWrapper> Struct;
+    /* Non-owning, the StructWrapper is kept alive by the MemberManager or the caller this function was retrieved from */
+    const StructWrapper* Struct;
 
     NameInfo Name;
 
     bool bIsUnrealFunction = false;
 
 public:
-    FunctionWrapper(const std::shared_ptr<StructWrapper>& Str, const PredefinedFunction* Predef);
+    FunctionWrapper(const StructWrapper* Str, const PredefinedFunction* Predef);
 
-    FunctionWrapper(const std::shared_ptr<StructWrapper>& Str, UEFunction Func);
+    FunctionWrapper(const StructWrapper* Str, UEFunction Func);
 
 public:
     StructWrapper AsStruct() const;
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+
+/*
+* Snapshot of all readable memory of the process. Doesn't depend on Windows, the regions are provided by a MemoryRegionSource,
+* which is backed by VirtualQuery in the dumper (see Utils.h) and by /proc/self/maps in tests (see MemoryRegionMapTest.h).
+*/
+
+/* Readable memory in [Start, End) */
+struct MemoryRegion
+{
+	uintptr_t Start;
+	uintptr_t End;
+};
+
+
+/* Platform specific enumeration of readable memory */
+class MemoryRegionSource
+{
+public:
+	virtual ~MemoryRegionSource() = default;
+
+public:
+	/* Appends all committed and readable regions of the process to 'OutRegions', in any order. Returns false if the regions couldn't be queried. */
+	virtual bool QueryReadableRegions(std::vector<MemoryRegion>& OutRegions) const = 0;
+};
+
+
+class MemoryRegionMap
+{
+private:
+	/* Sorted by address, adjacent and overlapping regions are merged */
+	std::vector<MemoryRegion> Regions;
+
+	std::chrono::steady_clock::time_point SnapshotTime;
+	bool bHasSnapshot = false;
+
+public:
+	/* Replaces the snapshot with the current regions of 'Source' */
+	inline bool Refresh(const MemoryRegionSource& Source)
+	{
+		std::vector<MemoryRegion> NewRegions;
+
+		if (!Source.QueryReadableRegions(NewRegions))
+			return false;
+
+		std::sort(NewRegions.begin(), NewRegions.end(), [](const MemoryRegion& Left, const MemoryRegion& Right) { return Left.Start < Right.Start; });
+
+		Regions.clear();
+
+		for (const MemoryRegion& Region : NewRegions)
+		{
+			if (Region.Start >= Region.End)
+				continue;
+
+			if (!Regions.empty() && Region.Start <= Regions.back().End)
+			{
+				if (Region.End > Regions.back().End)
+					Regions.back().End = Region.End;
+
+				continue;
+			}
+
+			Regions.push_back(Region);
+		}
+
+		SnapshotTime = std::chrono::steady_clock::now();
+		bHasSnapshot = true;
+
+		return true;
+	}
+
+	/* Whether all bytes in [Address, Address + Size) were readable when the snapshot was taken, O(log n) in the number of regions */
+	inline bool IsReadable(uintptr_t Address, uintptr_t Size = 0x1) const
+	{
+		if (Size == 0x0 || Address + Size < Address)
+			return false;
+
+		/* First region starting after 'Address', the one before it is the only one which can contain 'Address' */
+		auto It = std::upper_bound(Regions.begin(), Regions.end(), Address, [](uintptr_t Value, const MemoryRegion& Region) { return Value < Region.Start; });
+
+		if (It == Regions.begin())
+			return false;
+
+		--It;
+
+		return Address + Size <= It->End;
+	}
+
+public:
+	inline bool HasSnapshot() const
+	{
+		return bHasSnapshot;
+	}
+
+	inline std::chrono::steady_clock::duration GetSnapshotAge() const
+	{
+		return std::chrono::steady_clock::now() - SnapshotTime;
+	}
+
+	inline size_t GetNumRegions() const
+	{
+		return Regions.size();
+	}
+
+	inline const std::vector<MemoryRegion>& GetRegions() const
+	{
+		return Regions;
+	}
+};
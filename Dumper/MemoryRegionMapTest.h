@@ -0,0 +1,215 @@
+#pragma once
+#include <chrono>
+#include <random>
+#include <format>
+#include "MemoryRegionMap.h"
+#include "TestBase.h"
+
+#if defined(_WIN32)
+#include "Utils.h"
+
+using NativeMemoryRegionSource = WindowsMemoryRegionSource;
+#else
+#include <cstdio>
+
+/* Readable mappings listed in /proc/self/maps, allows testing the MemoryRegionMap outside of a game */
+class ProcMapsMemoryRegionSource : public MemoryRegionSource
+{
+public:
+	inline bool QueryReadableRegions(std::vector<MemoryRegion>& OutRegions) const override
+	{
+		FILE* MapsFile = fopen("/proc/self/maps", "r");
+
+		if (!MapsFile)
+			return false;
+
+		char Line[0x200];
+
+		while (fgets(Line, sizeof(Line), MapsFile))
+		{
+			unsigned long long Start = 0x0;
+			unsigned long long End = 0x0;
+			char Permissions[5] = {};
+
+			if (sscanf(Line, "%llx-%llx %4s", &Start, &End, Permissions) != 3)
+				continue;
+
+			if (Permissions[0] == 'r')
+				OutRegions.push_back({ static_cast<uintptr_t>(Start), static_cast<uintptr_t>(End) });
+		}
+
+		fclose(MapsFile);
+
+		return !OutRegions.empty();
+	}
+};
+
+using NativeMemoryRegionSource = ProcMapsMemoryRegionSource;
+#endif
+
+class MemoryRegionMapTest : protected TestBase
+{
+private:
+	class FixedMemoryRegionSource : public MemoryRegionSource
+	{
+	private:
+		std::vector<MemoryRegion> Regions;
+
+	public:
+		inline FixedMemoryRegionSource(std::vector<MemoryRegion>&& InRegions)
+			: Regions(std::move(InRegions))
+		{
+		}
+
+	public:
+		inline bool QueryReadableRegions(std::vector<MemoryRegion>& OutRegions) const override
+		{
+			OutRegions.insert(OutRegions.end(), Regions.begin(), Regions.end());
+			return true;
+		}
+	};
+
+public:
+	template<bool bDoDebugPrinting = false>
+	static inline void TestAll()
+	{
+		TestMerging<bDoDebugPrinting>();
+		TestNativeRegions<bDoDebugPrinting>();
+		TestLookupSpeed<bDoDebugPrinting>();
+
+		PrintDbgMessage<bDoDebugPrinting>("");
+	}
+
+	template<bool bDoDebugPrinting = false>
+	static inline void TestMerging()
+	{
+		/* Unsorted, adjacent and overlapping regions, like a region-list built from multiple sources */
+		const FixedMemoryRegionSource Source({ { 0x5000, 0x6000 }, { 0x1000, 0x2000 }, { 0x2000, 0x3000 }, { 0x5800, 0x7000 }, { 0x9000, 0x9000 } });
+
+		MemoryRegionMap Map;
+
+		bool bSuccededTestWithoutError = Map.Refresh(Source);
+
+		SetBoolIfFailed(bSuccededTestWithoutError, Map.GetNumRegions() == 0x2);
+
+		SetBoolIfFailed(bSuccededTestWithoutError, !Map.IsReadable(0x0FFF));
+		SetBoolIfFailed(bSuccededTestWithoutError, Map.IsReadable(0x1000));
+		SetBoolIfFailed(bSuccededTestWithoutError, Map.IsReadable(0x1FF8, 0x10));
+		SetBoolIfFailed(bSuccededTestWithoutError, Map.IsReadable(0x2FFF));
+		SetBoolIfFailed(bSuccededTestWithoutError, !Map.IsReadable(0x2FF8, 0x10));
+		SetBoolIfFailed(bSuccededTestWithoutError, !Map.IsReadable(0x3000));
+		SetBoolIfFailed(bSuccededTestWithoutError, Map.IsReadable(0x6FFF));
+		SetBoolIfFailed(bSuccededTestWithoutError, !Map.IsReadable(0x7000));
+		SetBoolIfFailed(bSuccededTestWithoutError, !Map.IsReadable(0x9000));
+		SetBoolIfFailed(bSuccededTestWithoutError, !Map.IsReadable(~0ull));
+
+		std::cout << __FUNCTION__ << ": " << (bSuccededTestWithoutError ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
+	template<bool bDoDebugPrinting = false>
+	static inline void TestNativeRegions()
+	{
+		MemoryRegionMap Map;
+
+		if (!Map.Refresh(NativeMemoryRegionSource()))
+		{
+			std::cout << __FUNCTION__ << ": " << "SKIPPED, regions can't be queried on this platform!" << std::endl;
+			return;
+		}
+
+		static const int StaticValue = 0x0;
+		const int StackValue = 0x0;
+		const std::vector<int> HeapValues(0x100);
+
+		bool bSuccededTestWithoutError = true;
+
+		SetBoolIfFailed(bSuccededTestWithoutError, Map.IsReadable(reinterpret_cast<uintptr_t>(&StaticValue), sizeof(StaticValue)));
+		SetBoolIfFailed(bSuccededTestWithoutError, Map.IsReadable(reinterpret_cast<uintptr_t>(&StackValue), sizeof(StackValue)));
+		SetBoolIfFailed(bSuccededTestWithoutError, Map.IsReadable(reinterpret_cast<uintptr_t>(HeapValues.data()), HeapValues.size() * sizeof(int)));
+		SetBoolIfFailed(bSuccededTestWithoutError, Map.IsReadable(reinterpret_cast<uintptr_t>(&TestNativeRegions<bDoDebugPrinting>)));
+		SetBoolIfFailed(bSuccededTestWithoutError, !Map.IsReadable(0x0));
+
+		PrintDbgMessage<bDoDebugPrinting>("{} --> {} readable regions", __FUNCTION__, Map.GetNumRegions());
+		std::cout << __FUNCTION__ << ": " << (bSuccededTestWithoutError ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
+	/* Looks up pointers inside of, and right after, random regions. Compared to a linear search for correctness and to a query per pointer for speed. */
+	template<bool bDoDebugPrinting = false>
+	static inline void TestLookupSpeed()
+	{
+		constexpr int32_t NumLookups = 0x100000;
+
+		MemoryRegionMap Map;
+
+		const auto RefreshStartTime = std::chrono::high_resolution_clock::now();
+
+		if (!Map.Refresh(NativeMemoryRegionSource()))
+		{
+			std::cout << __FUNCTION__ << ": " << "SKIPPED, regions can't be queried on this platform!" << std::endl;
+			return;
+		}
+
+		const double RefreshMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - RefreshStartTime).count();
+
+		const std::vector<MemoryRegion>& Regions = Map.GetRegions();
+
+		std::mt19937 Rng(0x5);
+		std::uniform_int_distribution<size_t> RegionDist(0x0, Regions.size() - 1);
+
+		std::vector<uintptr_t> Addresses;
+		Addresses.reserve(NumLookups);
+
+		for (int32_t i = 0; i < NumLookups; i++)
+		{
+			const MemoryRegion& Region = Regions[RegionDist(Rng)];
+			Addresses.push_back((i & 0x1) ? Region.End : Region.Start + (Rng() % (Region.End - Region.Start)));
+		}
+
+		auto IsReadableReference = [&Regions](uintptr_t Address) -> bool
+		{
+			for (const MemoryRegion& Region : Regions)
+			{
+				if (Address >= Region.Start && Address < Region.End)
+					return true;
+			}
+
+			return false;
+		};
+
+		int32_t NumReadable = 0x0;
+		int32_t NumMismatches = 0x0;
+
+		const auto LookupStartTime = std::chrono::high_resolution_clock::now();
+
+		for (const uintptr_t Address : Addresses)
+			NumReadable += Map.IsReadable(Address);
+
+		const double LookupMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - LookupStartTime).count();
+
+		for (const uintptr_t Address : Addresses)
+			NumMismatches += Map.IsReadable(Address) != IsReadableReference(Address);
+
+		const bool bSuccededTestWithoutError = NumMismatches == 0x0 && NumReadable == (NumLookups / 2);
+
+		PrintDbgMessage<bDoDebugPrinting>("{} --> Snapshot of {} regions took {:.2f}ms", __FUNCTION__, Map.GetNumRegions(), RefreshMs);
+		PrintDbgMessage<bDoDebugPrinting>("{} --> 0x{:X} lookups, MemoryRegionMap: {:.2f}ms", __FUNCTION__, NumLookups, LookupMs);
+
+#if defined(_WIN32)
+		int32_t NumReadableByQuery = 0x0;
+
+		const auto QueryStartTime = std::chrono::high_resolution_clock::now();
+
+		for (const uintptr_t Address : Addresses)
+		{
+			MEMORY_BASIC_INFORMATION Mbi;
+			NumReadableByQuery += VirtualQuery(reinterpret_cast<void*>(Address), &Mbi, sizeof(Mbi)) && IsReadablePageProtection(Mbi.Protect);
+		}
+
+		const double QueryMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - QueryStartTime).count();
+
+		PrintDbgMessage<bDoDebugPrinting>("{} --> 0x{:X} lookups, VirtualQuery: {:.2f}ms ({} readable, {} in snapshot)", __FUNCTION__, NumLookups, QueryMs, NumReadableByQuery, NumReadable);
+#endif
+
+		std::cout << __FUNCTION__ << ": " << (bSuccededTestWithoutError ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+};
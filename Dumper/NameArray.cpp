@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "NameArray.h"
 
 /* DEBUG */
@@ -288,7 +290,7 @@ bool NameArray::InitializeNamePool(uint8_t* NamePool)
 		if (ChunkIdx < 0 || ChunkIdx > GetNumChunks() || bIsBeyondLastChunk)
 			return nullptr;
 
-		uint8_t* ChunkPtr = reinterpret_cast<uint8_t*>(NamesArray) + 0x10;
+		uint8_t* ChunkPtr = reinterpret_cast<uint8_t*>(NamesArray) + Off::NameArray::ChunksStart;
 
 		return reinterpret_cast<uint8_t**>(ChunkPtr)[ChunkIdx] + InChunkOffset;
 	};
@@ -414,6 +416,11 @@ bool NameArray::TryFindNamePool()
 
 	uintptr_t Counter = 0x0;
 
+	/* Searches for both, the wchar_t string L"ByteProperty" and the char string "ByteProperty", in a single scan */
+	MultiPatternScanner BytePropertyRefScanner;
+	const int32 WideBytePropertyRefIdx = AddStringRefPattern(BytePropertyRefScanner, L"ByteProperty");
+	const int32 BytePropertyRefIdx = AddStringRefPattern(BytePropertyRefScanner, "ByteProperty");
+
 	while (!NamePoolIntance)
 	{
 		/* add 0x1 so we don't find the same occurence again and cause an infinite loop (20min. of debugging for that) */
@@ -450,13 +457,10 @@ bool NameArray::TryFindNamePool()
 				continue;
 
 			/* Try to find the "ByteProperty" string, as it's always referenced in FNamePool::FNamePool, so we use it to verify that we got the right function */
-			MemAddress StringRef = FindByStringInAllSections(L"ByteProperty", PossibleConstructorAddress, BytePropertySearchRange);
+			BytePropertyRefScanner.Reset();
+			ScanForStringRefsInAllSections(BytePropertyRefScanner, PossibleConstructorAddress, BytePropertySearchRange);
 
-			/* We couldn't find a wchar_t string L"ByteProperty", now see if we can find a char string "ByteProperty" */
-			if (!StringRef)
-				StringRef = FindByStringInAllSections("ByteProperty", PossibleConstructorAddress, BytePropertySearchRange);
-
-			if (StringRef)
+			if (BytePropertyRefScanner.GetResult(WideBytePropertyRefIdx) || BytePropertyRefScanner.GetResult(BytePropertyRefIdx))
 			{
 				NamePoolIntance = reinterpret_cast<void*>(ASMUtils::Resolve32BitRelativeMove(SigOccurrence));
 				break;
@@ -664,6 +668,209 @@ int32 NameArray::GetByteCursor()
 	return Settings::Internal::bUseNamePool ? *reinterpret_cast<int32*>(GNames + Off::NameArray::ByteCursor) : 0;
 }
 
+int32 DecodedNameTable::Find(int32 ComparisonIndex) const
+{
+	auto It = std::lower_bound(ComparisonIndices.begin(), ComparisonIndices.end(), ComparisonIndex);
+
+	if (It == ComparisonIndices.end() || *It != ComparisonIndex)
+		return -1;
+
+	return static_cast<int32>(It - ComparisonIndices.begin());
+}
+
+/* Appends a name in its in-memory encoding to 'Arena' as UTF-8 */
+static void AppendNameToArena(std::string& Arena, const uint8* Str, int32 Length, bool bIsWide)
+{
+	if (bIsWide)
+	{
+		Arena += UtfN::WStringToString(std::wstring(reinterpret_cast<const wchar_t*>(Str), Length));
+		return;
+	}
+
+	bool bIsPureAscii = true;
+
+	for (int i = 0; i < Length; i++)
+	{
+		if (Str[i] >= 0x80)
+		{
+			bIsPureAscii = false;
+			break;
+		}
+	}
+
+	/* Ascii is already valid UTF-8, anything else goes through the same conversion FNameEntry::GetString() uses */
+	if (bIsPureAscii)
+	{
+		Arena.append(reinterpret_cast<const char*>(Str), Length);
+		return;
+	}
+
+	Arena += UtfN::WStringToString(UtfN::StringToWString(std::string(reinterpret_cast<const char*>(Str), Length)));
+}
+
+void NameArray::DecodeNameArray(DecodedNameTable& OutTable)
+{
+	/* TNameEntryArray is a table of chunks, every chunk holds pointers to 0x4000 FNameEntries. Same layout NameArray::ByIndex uses. */
+	constexpr int32 NamesPerChunk = 0x4000;
+
+	const int32 NumElements = GetNumElements();
+
+	OutTable.ComparisonIndices.reserve(NumElements);
+	OutTable.Offsets.reserve(NumElements + 1);
+	OutTable.Arena.reserve(NumElements * 0x18);
+
+	const uint8* const* const* Chunks = reinterpret_cast<const uint8* const* const*>(GNames);
+
+	for (int32 ChunkStart = 0, ChunkIdx = 0; ChunkStart < NumElements; ChunkStart += NamesPerChunk, ChunkIdx++)
+	{
+		const uint8* const* Chunk = Chunks[ChunkIdx];
+
+		if (!Chunk)
+			continue;
+
+		const int32 NumInChunk = (NumElements - ChunkStart) < NamesPerChunk ? (NumElements - ChunkStart) : NamesPerChunk;
+
+		for (int32 InChunk = 0; InChunk < NumInChunk; InChunk++)
+		{
+			const uint8* NameEntry = Chunk[InChunk];
+
+			if (!NameEntry)
+				continue;
+
+			const int32 NameIdx = *reinterpret_cast<const int32*>(NameEntry + Off::FNameEntry::NameArray::IndexOffset);
+			const uint8* NameString = NameEntry + Off::FNameEntry::NameArray::StringOffset;
+
+			const bool bIsWide = NameIdx & FNameEntry::NameWideMask;
+			const int32 Length = static_cast<int32>(bIsWide ? wcslen(reinterpret_cast<const wchar_t*>(NameString)) : strlen(reinterpret_cast<const char*>(NameString)));
+
+			OutTable.ComparisonIndices.push_back(ChunkStart + InChunk);
+			OutTable.Offsets.push_back(static_cast<uint32>(OutTable.Arena.size()));
+			AppendNameToArena(OutTable.Arena, NameString, Length, bIsWide);
+		}
+	}
+}
+
+void NameArray::DecodeNamePool(DecodedNameTable& OutTable)
+{
+	const int32 HeaderOffset = Off::FNameEntry::NamePool::HeaderOffset;
+	const int32 StringOffset = Off::FNameEntry::NamePool::StringOffset;
+
+	/* Outline-number entries store the ComparisonIndex of the base-name and the number instead of a string */
+	const int32 EntryIdOffset = StringOffset + ((StringOffset == 6) * 2);
+
+	const int32 LastBlock = GetNumChunks();
+	const int64 BlockSizeBytes = static_cast<int64>(NameEntryStride) << FNameBlockOffsetBits;
+
+	uint8* const* Blocks = reinterpret_cast<uint8* const*>(GNames + Off::NameArray::ChunksStart);
+
+	/* First pass, find all entries. Entries are never resolved through ByIndex, blocks are just walked front to back. */
+	std::vector<const uint8*> Entries;
+	Entries.reserve((static_cast<int64>(LastBlock) * BlockSizeBytes + GetByteCursor()) / 0x18);
+
+	for (int32 Block = 0; Block <= LastBlock; Block++)
+	{
+		const uint8* BlockStart = Blocks[Block];
+
+		if (!BlockStart)
+			continue;
+
+		const int64 BlockEnd = Block == LastBlock ? GetByteCursor() : BlockSizeBytes;
+
+		for (int64 Offset = 0; (Offset + StringOffset) <= BlockEnd;)
+		{
+			const uint8* NameEntry = BlockStart + Offset;
+
+			const uint16 Header = *reinterpret_cast<const uint16*>(NameEntry + HeaderOffset);
+			const int32 NameLen = Header >> FNameEntry::FNameEntryLengthShiftCount;
+
+			int64 EntrySize = StringOffset + (NameLen * ((Header & FNameEntry::NameWideMask) ? sizeof(wchar_t) : sizeof(char)));
+
+			if (NameLen == 0)
+			{
+				/* Without outline-numbers an empty header marks the unused remainder of a block */
+				if (!Settings::Internal::bUseOutlineNumberName || (EntryIdOffset + 0x8) > (BlockEnd - Offset))
+					break;
+
+				const int32 BaseEntryIndex = *reinterpret_cast<const int32*>(NameEntry + EntryIdOffset);
+				const int32 Number = *reinterpret_cast<const int32*>(NameEntry + EntryIdOffset + sizeof(int32));
+
+				if (BaseEntryIndex == 0 && Number == 0)
+					break;
+
+				EntrySize = EntryIdOffset + 0x8;
+			}
+
+			const int32 ComparisonIndex = static_cast<int32>((static_cast<int64>(Block) << FNameBlockOffsetBits) | (Offset / NameEntryStride));
+
+			OutTable.ComparisonIndices.push_back(ComparisonIndex);
+			Entries.push_back(NameEntry);
+
+			Offset += Align(EntrySize, static_cast<int64>(NameEntryStride));
+		}
+	}
+
+	const auto AppendEntry = [&](const uint8* NameEntry) -> bool
+	{
+		const uint16 Header = *reinterpret_cast<const uint16*>(NameEntry + HeaderOffset);
+		const int32 NameLen = Header >> FNameEntry::FNameEntryLengthShiftCount;
+
+		if (NameLen == 0)
+			return false;
+
+		AppendNameToArena(OutTable.Arena, NameEntry + StringOffset, NameLen, Header & FNameEntry::NameWideMask);
+		return true;
+	};
+
+	/* Second pass, decode the strings. Outline-number entries are resolved against the entries found in the first pass. */
+	OutTable.Offsets.reserve(Entries.size() + 1);
+	OutTable.Arena.reserve(Entries.size() * 0x18);
+
+	for (const uint8* NameEntry : Entries)
+	{
+		OutTable.Offsets.push_back(static_cast<uint32>(OutTable.Arena.size()));
+
+		if (AppendEntry(NameEntry))
+			continue;
+
+		const int32 BaseEntryIndex = *reinterpret_cast<const int32*>(NameEntry + EntryIdOffset);
+		const int32 Number = *reinterpret_cast<const int32*>(NameEntry + EntryIdOffset + sizeof(int32));
+
+		const int32 BaseIndexInTable = OutTable.Find(BaseEntryIndex);
+
+		if (BaseIndexInTable != -1)
+			AppendEntry(Entries[BaseIndexInTable]);
+
+		if (Number > 0)
+			OutTable.Arena += '_' + std::to_string(Number - 1);
+	}
+}
+
+bool NameArray::DecodeAllNames(DecodedNameTable& OutTable)
+{
+	OutTable.Arena.clear();
+	OutTable.ComparisonIndices.clear();
+	OutTable.Offsets.clear();
+
+	if (!GNames || !FNameEntry::GetStr)
+	{
+		std::cout << "Dumper-7: Names can only be decoded in bulk if GNames was found!\n" << std::endl;
+		return false;
+	}
+
+	if (Settings::Internal::bUseNamePool)
+	{
+		DecodeNamePool(OutTable);
+	}
+	else
+	{
+		DecodeNameArray(OutTable);
+	}
+
+	OutTable.Offsets.push_back(static_cast<uint32>(OutTable.Arena.size()));
+
+	return true;
+}
+
 FNameEntry NameArray::GetNameEntry(const void* Name)
 {
 	return ByIndex(GNames, FName(Name).GetCompIdx(), FNameBlockOffsetBits);
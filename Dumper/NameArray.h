@@ -32,9 +32,43 @@ private:
 	static void Init(const uint8_t* FirstChunkPtr = nullptr, int64 NameEntryStringOffset = 0x0);
 };
 
+/* All names of GNames, decoded to UTF-8 in one pass. Names are stored back to back, sorted by their ComparisonIndex. */
+struct DecodedNameTable
+{
+	/* UTF-8 strings of all names, not null-terminated */
+	std::string Arena;
+
+	/* ComparisonIndex of every name, ascending */
+	std::vector<int32> ComparisonIndices;
+
+	/* Start of every name in 'Arena', followed by one entry for the end of the last name */
+	std::vector<uint32> Offsets;
+
+public:
+	inline int32 Num() const
+	{
+		return static_cast<int32>(ComparisonIndices.size());
+	}
+
+	inline int32 GetComparisonIndex(int32 Index) const
+	{
+		return ComparisonIndices[Index];
+	}
+
+	inline std::string_view GetName(int32 Index) const
+	{
+		return std::string_view(Arena).substr(Offsets[Index], Offsets[Index + 1] - Offsets[Index]);
+	}
+
+	/* Returns the position of 'ComparisonIndex' in this table, or -1 */
+	int32 Find(int32 ComparisonIndex) const;
+};
+
 class NameArray
 {
 private:
+	friend class OffsetCache;
+
 	static inline uint32 FNameBlockOffsetBits = 0x10;
 
 private:
@@ -48,6 +82,9 @@ private:
 	static bool InitializeNameArray(uint8_t* NameArray);
 	static bool InitializeNamePool(uint8_t* NamePool);
 
+	static void DecodeNameArray(DecodedNameTable& OutTable);
+	static void DecodeNamePool(DecodedNameTable& OutTable);
+
 public:
 	/* Should be changed later and combined */
 	static bool TryFindNameArray();
@@ -69,4 +106,11 @@ public:
 
 	static FNameEntry GetNameEntry(const void* Name);
 	static FNameEntry GetNameEntry(int32 Idx);
+
+	/* 
+	* Walks all FNamePool-blocks, or TNameEntryArray-chunks, sequentially and decodes every name once. Much faster than resolving names one by one.
+	* 
+	* Requires GNames, returns false if names are resolved through FName::AppendString/ToString only. Must be called after NameArray::PostInit().
+	*/
+	static bool DecodeAllNames(DecodedNameTable& OutTable);
 };
@@ -2,6 +2,8 @@
 #include <fstream>
 #include <format>
 #include <filesystem>
+#include <algorithm>
+#include <xmmintrin.h>
 #include "ObjectArray.h"
 #include "Offsets.h"
 #include "Utils.h"
@@ -360,7 +362,7 @@ void ObjectArray::Init(int32 GObjectsOffset, const FFixedUObjectArrayLayout& Obj
 		if (Index < 0 || Index > Num())
 			return nullptr;
 
-		uint8_t* ItemPtr = *reinterpret_cast<uint8_t**>(ObjectsArray) + (Index * FUObjectItemSize);
+		uint8_t* ItemPtr = DecryptPtr(*reinterpret_cast<uint8_t**>(ObjectsArray)) + (Index * FUObjectItemSize);
 
 		return *reinterpret_cast<void**>(ItemPtr + FUObjectItemOffset);
 	};
@@ -389,8 +391,10 @@ void ObjectArray::Init(int32 GObjectsOffset, int32 ElementsPerChunk, const FChun
 		const int32 ChunkIndex = Index / PerChunk;
 		const int32 InChunkIdx = Index % PerChunk;
 
-		uint8_t* Chunk = (*reinterpret_cast<uint8_t***>(ObjectsArray))[ChunkIndex];
-		uint8_t* ItemPtr = reinterpret_cast<uint8_t*>(Chunk) + (InChunkIdx * FUObjectItemSize);
+		uint8_t* ChunkPtr = DecryptPtr(*reinterpret_cast<uint8_t**>(ObjectsArray));
+
+		uint8_t* Chunk = reinterpret_cast<uint8_t**>(ChunkPtr)[ChunkIndex];
+		uint8_t* ItemPtr = Chunk + (InChunkIdx * FUObjectItemSize);
 
 		return *reinterpret_cast<void**>(ItemPtr + FUObjectItemOffset);
 	};
@@ -408,17 +412,21 @@ void ObjectArray::DumpObjects(const fs::path& Path, bool bWithPathname)
 	DumpStream << (!Settings::Generator::GameVersion.empty() && !Settings::Generator::GameName.empty() ? (Settings::Generator::GameVersion + '-' + Settings::Generator::GameName) + "\n\n" : "");
 	DumpStream << "Count: " << Num() << "\n\n\n";
 
-	for (auto Object : ObjectArray())
+	/* Names are resolved in parallel, each partition is written as one block afterwards to keep the order of GObjects */
+	const std::vector<std::string> Partitions = ParallelForEach<std::string>([bWithPathname](UEObject Object, std::string& OutText)
 	{
 		if (!bWithPathname)
 		{
-			DumpStream << std::format("[{:08X}] {{{}}} {}\n", Object.GetIndex(), Object.GetAddress(), Object.GetFullName());
+			OutText += std::format("[{:08X}] {{{}}} {}\n", Object.GetIndex(), Object.GetAddress(), Object.GetFullName());
 		}
 		else
 		{
-			DumpStream << std::format("[{:08X}] {{{}}} {}\n", Object.GetIndex(), Object.GetAddress(), Object.GetPathName());
+			OutText += std::format("[{:08X}] {{{}}} {}\n", Object.GetIndex(), Object.GetAddress(), Object.GetPathName());
 		}
-	}
+	});
+
+	for (const std::string& Text : Partitions)
+		DumpStream << Text;
 
 	DumpStream.close();
 }
@@ -431,25 +439,28 @@ void ObjectArray::DumpObjectsWithProperties(const fs::path& Path, bool bWithPath
 	DumpStream << (!Settings::Generator::GameVersion.empty() && !Settings::Generator::GameName.empty() ? (Settings::Generator::GameVersion + '-' + Settings::Generator::GameName) + "\n\n" : "");
 	DumpStream << "Count: " << Num() << "\n\n\n";
 
-	for (auto Object : ObjectArray())
+	const std::vector<std::string> Partitions = ParallelForEach<std::string>([bWithPathname](UEObject Object, std::string& OutText)
 	{
 		if (!bWithPathname)
 		{
-			DumpStream << std::format("[{:08X}] {{{}}} {}\n", Object.GetIndex(), Object.GetAddress(), Object.GetFullName());
+			OutText += std::format("[{:08X}] {{{}}} {}\n", Object.GetIndex(), Object.GetAddress(), Object.GetFullName());
 		}
 		else
 		{
-			DumpStream << std::format("[{:08X}] {{{}}} {}\n", Object.GetIndex(), Object.GetAddress(), Object.GetPathName());
+			OutText += std::format("[{:08X}] {{{}}} {}\n", Object.GetIndex(), Object.GetAddress(), Object.GetPathName());
 		}
 
 		if (Object.IsA(EClassCastFlags::Struct))
 		{
 			for (UEProperty Prop : Object.Cast<UEStruct>().GetProperties())
 			{
-				DumpStream << std::format("[{:08X}] {{{}}}\t{} {}\n", Prop.GetOffset(), Prop.GetAddress(), Prop.GetPropClassName(), Prop.GetName());
+				OutText += std::format("[{:08X}] {{{}}}\t{} {}\n", Prop.GetOffset(), Prop.GetAddress(), Prop.GetPropClassName(), Prop.GetName());
 			}
 		}
-	}
+	});
+
+	for (const std::string& Text : Partitions)
+		DumpStream << Text;
 
 	DumpStream.close();
 }
@@ -466,60 +477,488 @@ static UEType ObjectArray::GetByIndex(int32 Index)
 	return UEType(ByIndex(GObjects + Off::FUObjectArray::GetObjectsOffset(), Index, SizeOfFUObjectItem, FUObjectItemInitialOffset, NumElementsPerChunk));
 }
 
-template<typename UEType>
-UEType ObjectArray::FindObject(const std::string& FullName, EClassCastFlags RequiredType)
+
+ObjectArray::ObjectLookupIndex ObjectArray::LookupIndex;
+
+/* FNames are compared case-insensitively by the engine, objects sharing a ComparisonIndex only differ in casing */
+static std::string ToLowerAscii(std::string Str)
+{
+	for (char& C : Str)
+	{
+		if (C >= 'A' && C <= 'Z')
+			C += ('a' - 'A');
+	}
+
+	return Str;
+}
+
+void ObjectArray::UpdateLookupIndex()
+{
+	/* Name-offsets can still change during Off::Init(), an index built with outdated offsets is useless */
+	if (LookupIndex.UObjectNameOffset != Off::UObject::Name || LookupIndex.FNameNumberOffset != Off::FName::Number)
+	{
+		LookupIndex = ObjectLookupIndex();
+		LookupIndex.UObjectNameOffset = Off::UObject::Name;
+		LookupIndex.FNameNumberOffset = Off::FName::Number;
+	}
+
+	const int32 NumObjects = Num();
+
+	if (NumObjects <= LookupIndex.NumIndexedObjects)
+		return;
+
+	/* Building the index from scratch indexes every slot as it currently is */
+	if (LookupIndex.NumIndexedObjects == 0)
+		LookupIndex.NumObjectsAtLastReindex = NumObjects;
+
+	LookupIndex.Slots.resize(NumObjects);
+
+	for (ObjectsIterator ObjIt(LookupIndex.NumIndexedObjects), End(NumObjects); ObjIt != End; ++ObjIt)
+		AddToLookupIndex(ObjIt.GetIndex(), *ObjIt);
+
+	LookupIndex.NumIndexedObjects = NumObjects;
+}
+
+void ObjectArray::AddToLookupIndex(int32 Index, UEObject Obj)
+{
+	const FName ObjName = Obj.GetFName();
+	const int32 CompIdx = ObjName.GetCompIdx();
+
+	LookupIndex.Slots[Index] = { Obj.GetAddress(), CompIdx };
+
+	auto [It, bIsNewCompIdx] = LookupIndex.CompIdxToObjects.try_emplace(CompIdx);
+
+	/* Keep the candidates sorted, re-indexed slots can be lower than the ones already in the list */
+	std::vector<int32>& Candidates = It->second;
+	Candidates.insert(std::upper_bound(Candidates.begin(), Candidates.end(), Index), Index);
+
+	if (!bIsNewCompIdx)
+		return;
+
+	/* Only resolve the string once per ComparisonIndex, removing the "_N" suffix that is appended for FName::Number */
+	std::string Name(ObjName.ToStringView());
+
+	if (const uint32 Number = ObjName.GetNumber(); Number > 0)
+	{
+		const std::string NumberSuffix = '_' + std::to_string(Number - 1);
+
+		if (Name.ends_with(NumberSuffix))
+			Name.erase(Name.size() - NumberSuffix.size());
+	}
+
+	LookupIndex.NameToCompIdx.emplace(ToLowerAscii(std::move(Name)), CompIdx);
+}
+
+void ObjectArray::RemoveFromLookupIndex(int32 Index)
+{
+	ObjectLookupIndex::IndexedSlot& Slot = LookupIndex.Slots[Index];
+
+	if (!Slot.Object)
+		return;
+
+	/* The name stays in NameToCompIdx, a ComparisonIndex always refers to the same string */
+	auto It = LookupIndex.CompIdxToObjects.find(Slot.CompIdx);
+
+	if (It != LookupIndex.CompIdxToObjects.end())
+	{
+		std::vector<int32>& Candidates = It->second;
+
+		auto [First, Last] = std::equal_range(Candidates.begin(), Candidates.end(), Index);
+		Candidates.erase(First, Last);
+	}
+
+	Slot = ObjectLookupIndex::IndexedSlot();
+}
+
+bool ObjectArray::ReindexSlot(int32 Index)
+{
+	const UEObject Obj = GetByIndex(Index);
+
+	const ObjectLookupIndex::IndexedSlot& Slot = LookupIndex.Slots[Index];
+
+	/* Only compares the pointer and the ComparisonIndex, no strings are built for unchanged slots */
+	if (Obj.GetAddress() == Slot.Object && (!Obj || Obj.GetFName().GetCompIdx() == Slot.CompIdx))
+		return false;
+
+	RemoveFromLookupIndex(Index);
+
+	if (Obj)
+		AddToLookupIndex(Index, Obj);
+
+	return true;
+}
+
+bool ObjectArray::ReindexChangedSlots()
+{
+	bool bAnySlotChanged = false;
+
+	for (int32 i = 0; i < LookupIndex.NumIndexedObjects; i++)
+		bAnySlotChanged |= ReindexSlot(i);
+
+	LookupIndex.NumObjectsAtLastReindex = LookupIndex.NumIndexedObjects;
+
+	return bAnySlotChanged;
+}
+
+template<typename PredicateType>
+int32 ObjectArray::FindObjectIndexByName(const std::string& Name, PredicateType&& Predicate)
 {
-	for (UEObject Object : ObjectArray())
+	std::scoped_lock Lock(LookupIndexMutex);
+
+	UpdateLookupIndex();
+
+	int32 FoundIndex = -1;
+
+	/* Candidates whose slot was reused by a different object, or whose object was renamed, since they were indexed */
+	std::vector<int32> ChangedSlots;
+
+	auto CheckCandidates = [&](const std::string& NameWithoutNumber) -> void
+	{
+		auto NameIt = LookupIndex.NameToCompIdx.find(ToLowerAscii(NameWithoutNumber));
+
+		if (NameIt == LookupIndex.NameToCompIdx.end())
+			return;
+
+		auto CandidatesIt = LookupIndex.CompIdxToObjects.find(NameIt->second);
+
+		if (CandidatesIt == LookupIndex.CompIdxToObjects.end())
+			return;
+
+		for (const int32 Index : CandidatesIt->second)
+		{
+			/* Candidates are sorted, keep the result equal to a linear search over GObjects */
+			if (FoundIndex != -1 && Index >= FoundIndex)
+				break;
+
+			UEObject Obj = GetByIndex(Index);
+
+			if (!Obj || Obj.GetAddress() != LookupIndex.Slots[Index].Object || Obj.GetFName().GetCompIdx() != NameIt->second)
+			{
+				ChangedSlots.push_back(Index);
+				continue;
+			}
+
+			if (Predicate(Obj) && Obj.GetNameView() == Name)
+			{
+				FoundIndex = Index;
+				break;
+			}
+		}
+	};
+
+	auto SearchLookupIndex = [&]() -> void
 	{
-		if (Object.IsA(RequiredType) && Object.GetFullName() == FullName)
+		CheckCandidates(Name);
+
+		/* "Name_3" can also be an FName of "Name" with a Number of 4 */
+		const size_t UnderscorePos = Name.rfind('_');
+
+		if (UnderscorePos != std::string::npos && UnderscorePos + 1 < Name.size())
 		{
-			return Object.Cast<UEType>();
+			const bool bIsNumberSuffix = std::all_of(Name.begin() + UnderscorePos + 1, Name.end(), [](char C) { return C >= '0' && C <= '9'; });
+
+			if (bIsNumberSuffix)
+				CheckCandidates(Name.substr(0, UnderscorePos));
+		}
+	};
+
+	SearchLookupIndex();
+
+	/* Only the changed candidates are re-indexed, the objects now living in their slots might be the ones searched for */
+	if (!ChangedSlots.empty())
+	{
+		bool bAnySlotChanged = false;
+
+		for (const int32 Index : ChangedSlots)
+			bAnySlotChanged |= ReindexSlot(Index);
+
+		ChangedSlots.clear();
+
+		if (bAnySlotChanged)
+		{
+			FoundIndex = -1;
+			SearchLookupIndex();
 		}
 	}
 
-	return UEType();
+	/*
+	* An object created in a freed slot is still indexed under the name of the previous object. Checking all slots on every miss made
+	* misses O(n), so all slots are only re-checked once GObjects grew since the last check. Misses are O(1) otherwise.
+	*/
+	if (FoundIndex == -1 && LookupIndex.NumObjectsAtLastReindex != LookupIndex.NumIndexedObjects && ReindexChangedSlots())
+		SearchLookupIndex();
+
+	return FoundIndex;
+}
+
+template<typename UEType>
+UEType ObjectArray::FindObject(const std::string& FullName, EClassCastFlags RequiredType)
+{
+	/* Names of UObjects can contain neither '.', ' ' nor ':' (subobject-seperator used by the engine), the name is everything after the last seperator */
+	const size_t SeperatorPos = FullName.find_last_of(". :");
+
+	const std::string Name = SeperatorPos != std::string::npos ? FullName.substr(SeperatorPos + 1) : FullName;
+
+	const int32 Index = FindObjectIndexByName(Name, [&](UEObject Object) -> bool
+	{
+		return Object.IsA(RequiredType) && Object.GetFullName() == FullName;
+	});
+
+	return Index != -1 ? GetByIndex<UEType>(Index) : UEType();
 }
 
 template<typename UEType>
 UEType ObjectArray::FindObjectFast(const std::string& Name, EClassCastFlags RequiredType)
 {
-	auto ObjArray = ObjectArray();
+	const int32 Index = FindObjectIndexByName(Name, [RequiredType](UEObject Object) -> bool
+	{
+		return Object.IsA(RequiredType);
+	});
+
+	return Index != -1 ? GetByIndex<UEType>(Index) : UEType();
+}
 
-	for (UEObject Object : ObjArray)
+template<typename UEType>
+static UEType ObjectArray::FindObjectFastInOuter(const std::string& Name, std::string Outer)
+{
+	const int32 Index = FindObjectIndexByName(Name, [&Outer](UEObject Object) -> bool
 	{
-		if (Object.IsA(RequiredType) && Object.GetName() == Name)
+		return Object.GetOuter().GetNameView() == Outer;
+	});
+
+	return Index != -1 ? GetByIndex<UEType>(Index) : UEType();
+}
+
+UEClass ObjectArray::FindClass(const std::string& FullName)
+{
+	return FindObject<UEClass>(FullName, EClassCastFlags::Class);
+}
+
+UEClass ObjectArray::FindClassFast(const std::string& Name)
+{
+	return FindObjectFast<UEClass>(Name, EClassCastFlags::Class);
+}
+
+ObjectArray::ClassHierarchyIndex ObjectArray::HierarchyIndex;
+
+void ObjectArray::RebuildHierarchyIndex()
+{
+	const int32 NumObjects = Num();
+
+	HierarchyIndex.UObjectClassOffset = Off::UObject::Class;
+	HierarchyIndex.UStructSuperOffset = Off::UStruct::SuperStruct;
+	HierarchyIndex.Intervals.assign(NumObjects, ClassHierarchyIndex::ClassInterval());
+
+	std::vector<ClassHierarchyIndex::ClassInterval>& Intervals = HierarchyIndex.Intervals;
+
+	for (ObjectsIterator It(0), End(NumObjects); It != End; ++It)
+	{
+		UEObject Obj = *It;
+
+		if (Obj.IsA(EClassCastFlags::Class))
+			Intervals[It.GetIndex()].Class = Obj.GetAddress();
+	}
+
+	/* Children of each class as singly-linked list, FirstChild[Super] -> NextSibling[Child] -> NextSibling[NextChild] ... */
+	std::vector<int32> FirstChild(NumObjects, -1);
+	std::vector<int32> NextSibling(NumObjects, -1);
+	std::vector<int32> Roots;
+
+	for (int32 i = 0; i < NumObjects; i++)
+	{
+		if (!Intervals[i].Class)
+			continue;
+
+		UEStruct Super = UEClass(Intervals[i].Class).GetSuper();
+		const int32 SuperIndex = Super ? Super.GetIndex() : -1;
+
+		if (SuperIndex < 0 || SuperIndex >= NumObjects || Intervals[SuperIndex].Class != Super.GetAddress())
 		{
-			return Object.Cast<UEType>();
+			Roots.push_back(i);
+			continue;
 		}
+
+		NextSibling[i] = FirstChild[SuperIndex];
+		FirstChild[SuperIndex] = i;
 	}
 
-	return UEType();
+	/* Iterative DFS, a class is left on the stack until all of its children were numbered */
+	int32 Counter = 0;
+	std::vector<int32> Stack;
+
+	for (int32 Root : Roots)
+	{
+		Stack.push_back(Root);
+
+		while (!Stack.empty())
+		{
+			ClassHierarchyIndex::ClassInterval& Current = Intervals[Stack.back()];
+
+			if (Current.Pre != -1)
+			{
+				Current.Post = Counter - 1;
+				Stack.pop_back();
+				continue;
+			}
+
+			Current.Pre = Counter++;
+
+			for (int32 Child = FirstChild[Stack.back()]; Child != -1; Child = NextSibling[Child])
+				Stack.push_back(Child);
+		}
+	}
 }
 
-template<typename UEType>
-static UEType ObjectArray::FindObjectFastInOuter(const std::string& Name, std::string Outer)
+bool ObjectArray::AppendToHierarchyIndex(UEClass Class)
 {
-	auto ObjArray = ObjectArray();
+	/* Unindexed classes, starting at 'Class' and ending below the first indexed super */
+	std::vector<UEClass> UnindexedChain;
+
+	for (UEClass Current = Class; Current && !FindClassInterval(Current); Current = UEClass(Current.GetSuper().GetAddress()))
+	{
+		if (Current.GetIndex() < 0 || std::find(UnindexedChain.begin(), UnindexedChain.end(), Current) != UnindexedChain.end())
+			return false;
+
+		UnindexedChain.push_back(Current);
+	}
+
+	std::vector<ClassHierarchyIndex::ClassInterval>& Intervals = HierarchyIndex.Intervals;
 
-	for (UEObject Object : ObjArray)
+	/* Supers first, so every appended class links to an indexed super */
+	for (auto It = UnindexedChain.rbegin(); It != UnindexedChain.rend(); ++It)
 	{
-		if (Object.GetName() == Name && Object.GetOuter().GetName() == Outer)
+		const UEClass Current = *It;
+		const UEStruct Super = Current.GetSuper();
+
+		const int32 Index = Current.GetIndex();
+
+		if (Index >= static_cast<int32>(Intervals.size()))
+			Intervals.resize(static_cast<size_t>(Index) + 1);
+
+		ClassHierarchyIndex::ClassInterval& Interval = Intervals[Index];
+		Interval.Class = Current.GetAddress();
+		Interval.Pre = -1;
+		Interval.Post = -1;
+		Interval.bIsAppended = true;
+		Interval.AppendedSuper = Super ? Super.GetIndex() : -1;
+	}
+
+	return true;
+}
+
+const ObjectArray::ClassHierarchyIndex::ClassInterval* ObjectArray::FindClassInterval(UEClass Class)
+{
+	const int32 Index = Class.GetIndex();
+
+	if (Index < 0 || Index >= static_cast<int32>(HierarchyIndex.Intervals.size()))
+		return nullptr;
+
+	const ClassHierarchyIndex::ClassInterval& Interval = HierarchyIndex.Intervals[Index];
+
+	/* Classes in a corrupted (cyclic) super-chain are never numbered */
+	if (Interval.Class != Class.GetAddress() || (Interval.Pre == -1 && !Interval.bIsAppended))
+		return nullptr;
+
+	return &Interval;
+}
+
+bool ObjectArray::TryCompareClassIntervals(UEClass Class, UEClass Super, bool& bOutIsSubclass)
+{
+	if (HierarchyIndex.UObjectClassOffset != Off::UObject::Class || HierarchyIndex.UStructSuperOffset != Off::UStruct::SuperStruct)
+		return false;
+
+	const ClassHierarchyIndex::ClassInterval* ClassInterval = FindClassInterval(Class);
+	const ClassHierarchyIndex::ClassInterval* SuperInterval = FindClassInterval(Super);
+
+	if (!ClassInterval || !SuperInterval)
+		return false;
+
+	/* Appended classes aren't numbered, walk up to the first numbered super. Appended chains are only as long as the classes created after init. */
+	while (ClassInterval->bIsAppended)
+	{
+		if (ClassInterval == SuperInterval)
 		{
-			return Object.Cast<UEType>();
+			bOutIsSubclass = true;
+			return true;
 		}
+
+		if (ClassInterval->AppendedSuper == -1)
+		{
+			bOutIsSubclass = false;
+			return true;
+		}
+
+		ClassInterval = &HierarchyIndex.Intervals[ClassInterval->AppendedSuper];
+
+		if (!ClassInterval->Class)
+			return false;
 	}
 
-	return UEType();
+	/* A numbered class was indexed before any appended class, so it can't derive from one */
+	bOutIsSubclass = !SuperInterval->bIsAppended && SuperInterval->Pre <= ClassInterval->Pre && ClassInterval->Pre <= SuperInterval->Post;
+	return true;
 }
 
-UEClass ObjectArray::FindClass(const std::string& FullName)
+bool ObjectArray::IsSubclassOf(UEClass Class, UEClass Super)
 {
-	return FindObject<UEClass>(FullName, EClassCastFlags::Class);
+	if (!Class || !Super)
+		return false;
+
+	bool bIsSubclass = false;
+
+	if (bIsHierarchyIndexFrozen.load(std::memory_order_acquire))
+	{
+		if (TryCompareClassIntervals(Class, Super, bIsSubclass))
+			return bIsSubclass;
+	}
+	else
+	{
+		{
+			std::shared_lock Lock(HierarchyIndexMutex);
+
+			if (TryCompareClassIntervals(Class, Super, bIsSubclass))
+				return bIsSubclass;
+		}
+
+		std::unique_lock Lock(HierarchyIndexMutex);
+
+		const bool bOffsetsChanged = HierarchyIndex.UObjectClassOffset != Off::UObject::Class || HierarchyIndex.UStructSuperOffset != Off::UStruct::SuperStruct;
+
+		/* A class unknown to the index was either created after the index was built, or placed in a reused GObjects-slot */
+		if (bOffsetsChanged)
+		{
+			RebuildHierarchyIndex();
+		}
+		else
+		{
+			AppendToHierarchyIndex(Class);
+			AppendToHierarchyIndex(Super);
+		}
+
+		if (TryCompareClassIntervals(Class, Super, bIsSubclass))
+			return bIsSubclass;
+	}
+
+	/* Fallback for classes which can't be indexed, or which were created after the index was frozen. A super-chain can't be longer than GObjects, unless it's cyclic. */
+	int32 NumSupersLeft = Num();
+
+	for (UEStruct S = Class; S && NumSupersLeft > 0; S = S.GetSuper(), NumSupersLeft--)
+	{
+		if (S == Super)
+			return true;
+	}
+
+	return false;
 }
 
-UEClass ObjectArray::FindClassFast(const std::string& Name)
+void ObjectArray::FreezeHierarchyIndex()
 {
-	return FindObjectFast<UEClass>(Name, EClassCastFlags::Class);
+	std::unique_lock Lock(HierarchyIndexMutex);
+
+	/* Numbers appended classes too, so only classes created after this point need to walk their super-chain */
+	RebuildHierarchyIndex();
+
+	bIsHierarchyIndexFrozen.store(true, std::memory_order_release);
 }
 
 ObjectArray::ObjectsIterator ObjectArray::begin()
@@ -533,8 +972,30 @@ ObjectArray::ObjectsIterator ObjectArray::end()
 
 
 ObjectArray::ObjectsIterator::ObjectsIterator(int32 StartIndex)
-	: CurrentIndex(StartIndex), CurrentObject(ObjectArray::GetByIndex(StartIndex))
+	: CurrentIndex(StartIndex), NumObjects(ObjectArray::Num())
 {
+	if (StartIndex < 0 || StartIndex >= NumObjects)
+		return;
+
+	uint8* ObjectsPtr = DecryptPtr(*reinterpret_cast<uint8**>(GObjects + Off::FUObjectArray::GetObjectsOffset()));
+
+	if (Off::FUObjectArray::bIsChunked)
+	{
+		Chunks = reinterpret_cast<uint8* const*>(ObjectsPtr);
+
+		CurrentItem = Chunks[StartIndex / NumElementsPerChunk] + ((StartIndex % NumElementsPerChunk) * SizeOfFUObjectItem);
+		NumLeftInChunk = NumElementsPerChunk - (StartIndex % NumElementsPerChunk);
+	}
+	else
+	{
+		CurrentItem = ObjectsPtr + (StartIndex * SizeOfFUObjectItem);
+		NumLeftInChunk = NumObjects - StartIndex;
+	}
+
+	CurrentObject = *reinterpret_cast<void**>(CurrentItem + FUObjectItemInitialOffset);
+
+	if (!CurrentObject)
+		++(*this);
 }
 
 UEObject ObjectArray::ObjectsIterator::operator*()
@@ -544,22 +1005,40 @@ UEObject ObjectArray::ObjectsIterator::operator*()
 
 ObjectArray::ObjectsIterator& ObjectArray::ObjectsIterator::operator++()
 {
-	CurrentObject = ObjectArray::GetByIndex(++CurrentIndex);
-
-	while (!CurrentObject && CurrentIndex < (ObjectArray::Num() - 1))
+	do
 	{
-		CurrentObject = ObjectArray::GetByIndex(++CurrentIndex);
-	}
+		if (++CurrentIndex >= NumObjects) [[unlikely]]
+		{
+			CurrentIndex = NumObjects;
+			CurrentObject = nullptr;
+			break;
+		}
 
-	if (!CurrentObject && CurrentIndex == (ObjectArray::Num() - 1)) [[unlikely]]
-		CurrentIndex++;
+		if (--NumLeftInChunk > 0) [[likely]]
+		{
+			CurrentItem += SizeOfFUObjectItem;
+		}
+		else
+		{
+			CurrentItem = Chunks[CurrentIndex / NumElementsPerChunk];
+			NumLeftInChunk = NumElementsPerChunk;
+		}
+
+		/* Prefetching never faults, the pointer read is kept inside of the current chunk though */
+		if (NumLeftInChunk > PrefetchDistance)
+			_mm_prefetch(*reinterpret_cast<const char* const*>(CurrentItem + (PrefetchDistance * SizeOfFUObjectItem) + FUObjectItemInitialOffset), _MM_HINT_T0);
+
+		CurrentObject = *reinterpret_cast<void**>(CurrentItem + FUObjectItemInitialOffset);
+	}
+	while (!CurrentObject);
 
 	return *this;
 }
 
 bool ObjectArray::ObjectsIterator::operator!=(const ObjectsIterator& Other)
 {
-	return CurrentIndex != Other.CurrentIndex;
+	/* GObjects might have grown between the calls to begin() and end() */
+	return CurrentIndex < Other.CurrentIndex && CurrentIndex < NumObjects;
 }
 
 int32 ObjectArray::ObjectsIterator::GetIndex() const
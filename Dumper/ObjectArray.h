@@ -1,6 +1,12 @@
 #pragma once
 #include <string>
 #include <vector>
+#include <unordered_map>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <atomic>
+#include <exception>
 #include <filesystem>
 #include "UnrealObjects.h"
 
@@ -14,6 +20,7 @@ private:
 	friend struct FChunkedFixedUObjectArray;
 	friend struct FFixedUObjectArray;
 	friend class ObjectArrayValidator;
+	friend class OffsetCache;
 
 	friend bool IsAddressValidGObjects(const uintptr_t, const struct FFixedUObjectArrayLayout&);
 	friend bool IsAddressValidGObjects(const uintptr_t, const struct FChunkedFixedUObjectArrayLayout&);
@@ -32,10 +39,107 @@ private:
 
 	static inline uint8_t* (*DecryptPtr)(void* ObjPtr) = [](void* Ptr) -> uint8* { return static_cast<uint8*>(Ptr); };
 
+private:
+	/* Name-based lookup index used by all FindObject* functions. Built lazily on first use and extended when GObjects grows. */
+	struct ObjectLookupIndex
+	{
+		/* Object and FName::ComparisonIndex of a GObjects-slot at the time it was indexed, used to detect reused slots */
+		struct IndexedSlot
+		{
+			void* Object = nullptr;
+			int32 CompIdx = -1;
+		};
+
+		/* Number of GObjects-slots which have already been added to the index */
+		int32 NumIndexedObjects = 0;
+
+		/* NumIndexedObjects when all slots were last checked for reused slots, see FindObjectIndexByName() */
+		int32 NumObjectsAtLastReindex = 0;
+
+		/* Offsets the index was built with, changing any of these (eg. in OffsetFinder::PostInitFNameSettings) forces a rebuild */
+		int32 UObjectNameOffset = -1;
+		int32 FNameNumberOffset = -1;
+
+		/* FName::ComparisonIndex -> indices of all objects using this ComparisonIndex, sorted ascending */
+		std::unordered_map<int32, std::vector<int32>> CompIdxToObjects;
+
+		/* Lower-case name without the number-suffix -> FName::ComparisonIndex */
+		std::unordered_map<std::string, int32> NameToCompIdx;
+
+		/* Dense, indexed by UObject::Index */
+		std::vector<IndexedSlot> Slots;
+	};
+
+	static ObjectLookupIndex LookupIndex;
+
+	/* FindObject* is called from the package-generation threads, which all share (and lazily extend) the LookupIndex */
+	static inline std::mutex LookupIndexMutex;
+
+	/* Pre-/post-order numbering of the UClass hierarchy. A class derives from another class if its interval is nested in the other classes interval. */
+	struct ClassHierarchyIndex
+	{
+		struct ClassInterval
+		{
+			/* Address of the UClass when it was indexed, used to detect reused GObjects-slots */
+			void* Class = nullptr;
+
+			int32 Pre = -1;
+			int32 Post = -1;
+
+			/* Classes added after the index was built aren't numbered, they only link to the index of their super (or -1) */
+			bool bIsAppended = false;
+			int32 AppendedSuper = -1;
+		};
+
+		/* Offsets the index was built with, changing any of these (eg. during Off::Init()) forces a rebuild */
+		int32 UObjectClassOffset = -1;
+		int32 UStructSuperOffset = -1;
+
+		/* Dense, indexed by UObject::Index */
+		std::vector<ClassInterval> Intervals;
+	};
+
+	static ClassHierarchyIndex HierarchyIndex;
+
+	/* IsA is called from the package-generation threads, rebuilds and appends are rare and take the lock exclusively */
+	static inline std::shared_mutex HierarchyIndexMutex;
+
+	/* Set once all offsets are known, the index isn't modified afterwards and is read without locking */
+	static inline std::atomic<bool> bIsHierarchyIndexFrozen = false;
+
+	/* Maximum number of threads ParallelForEach() uses when called from this thread, 0 -> no limit */
+	static inline thread_local int32 ParallelForEachThreadLimit = 0;
+
 private:
 	static void InitializeFUObjectItem(uint8_t* FirstItemPtr);
 	static void InitializeChunkSize(uint8_t* GObjects);
 
+	static void UpdateLookupIndex();
+
+	static void AddToLookupIndex(int32 Index, UEObject Obj);
+	static void RemoveFromLookupIndex(int32 Index);
+
+	/* Re-indexes the slot if its object, or the objects name, changed since it was indexed. Returns true if the slot changed. */
+	static bool ReindexSlot(int32 Index);
+
+	/* Re-indexes all slots whose object, or its name, changed since they were indexed. Returns true if any slot changed. */
+	static bool ReindexChangedSlots();
+
+	static void RebuildHierarchyIndex();
+
+	/* Appends 'Class' and all of its unindexed supers without renumbering the index, returns false if the super-chain is cyclic */
+	static bool AppendToHierarchyIndex(UEClass Class);
+
+	/* Returns nullptr if 'Class' isn't part of the current HierarchyIndex */
+	static const ClassHierarchyIndex::ClassInterval* FindClassInterval(UEClass Class);
+
+	/* Returns true if both classes are indexed, the result is written to 'bOutIsSubclass' */
+	static bool TryCompareClassIntervals(UEClass Class, UEClass Super, bool& bOutIsSubclass);
+
+	/* Returns the lowest index of an object named 'Name' for which 'Predicate' returns true, or -1 */
+	template<typename PredicateType>
+	static int32 FindObjectIndexByName(const std::string& Name, PredicateType&& Predicate);
+
 public:
 	static void InitDecryption(uint8_t* (*DecryptionFunction)(void* ObjPtr), const char* DecryptionLambdaAsStr);
 
@@ -65,11 +169,48 @@ public:
 
 	static UEClass FindClassFast(const std::string& Name);
 
+	/* Whether 'Class' is, or inherits from, 'Super'. Constant time for all classes known to the HierarchyIndex. */
+	static bool IsSubclassOf(UEClass Class, UEClass Super);
+
+	/* Numbers all current classes and stops modifying the HierarchyIndex, IsSubclassOf doesn't lock afterwards. Must be called once all offsets are known. */
+	static void FreezeHierarchyIndex();
+
+	/*
+	* Calls 'Callback(UEObject Obj, AccumulatorType& Accumulator)' for every object in GObjects, using multiple threads.
+	* 
+	* GObjects is partitioned by chunk and every partition gets its own accumulator. The accumulators are returned in partition-order,
+	* merging them front to back visits the objects in the same order as a sequential loop would. 'Callback' must not write to shared state.
+	* 
+	* If 'Callback' throws, the remaining partitions are skipped and the first exception is rethrown on the calling thread.
+	*/
+	template<typename AccumulatorType, typename CallbackType>
+	static std::vector<AccumulatorType> ParallelForEach(CallbackType&& Callback);
+
+	/* Limits the threads used by ParallelForEach() on the calling thread, used by tasks which run concurrently to each other to not oversubscribe the CPU */
+	static inline void SetParallelForEachThreadLimit(int32 MaxThreads) { ParallelForEachThreadLimit = MaxThreads; }
+
+	/*
+	* Walks GObjects chunk by chunk. The objects-pointer is decrypted once and Num() is read once on construction, advancing only
+	* steps to the next FUObjectItem. Objects added to GObjects during the iteration are not visited.
+	*/
 	class ObjectsIterator
 	{
+	private:
+		/* Number of FUObjectItems ahead of the current one for which the UObject is prefetched */
+		static constexpr int32 PrefetchDistance = 0x8;
+
+	private:
 		UEObject CurrentObject;
 		int32 CurrentIndex;
 
+		int32 NumObjects = 0x0;
+
+		/* Decrypted chunk-table, nullptr for FFixedUObjectArray, where all items are considered to be in a single chunk */
+		uint8* const* Chunks = nullptr;
+		uint8* CurrentItem = nullptr;
+
+		int32 NumLeftInChunk = 0x0;
+
 	public:
 		ObjectsIterator(int32 StartIndex = 0);
 
@@ -89,6 +230,72 @@ public:
 	}
 };
 
+template<typename AccumulatorType, typename CallbackType>
+inline std::vector<AccumulatorType> ObjectArray::ParallelForEach(CallbackType&& Callback)
+{
+	/* FFixedUObjectArray has no chunks, split it into partitions of the default chunk-size instead */
+	constexpr int32 DefaultPartitionSize = 0x10000;
+
+	const int32 NumObjects = Num();
+	const int32 PartitionSize = Off::FUObjectArray::bIsChunked ? static_cast<int32>(NumElementsPerChunk) : DefaultPartitionSize;
+	const int32 NumPartitions = (NumObjects + PartitionSize - 1) / PartitionSize;
+
+	std::vector<AccumulatorType> Accumulators(NumPartitions);
+	std::atomic<int32> NextPartition = 0;
+
+	/* An exception escaping a worker would terminate the process, the first one is rethrown on the calling thread instead */
+	std::exception_ptr FirstException;
+	std::mutex ExceptionMutex;
+	std::atomic<bool> bHasFailed = false;
+
+	auto ProcessPartitionsWorker = [&]()
+	{
+		try
+		{
+			for (int32 i = NextPartition++; i < NumPartitions && !bHasFailed; i = NextPartition++)
+			{
+				const int32 PartitionEnd = (i + 1) < NumPartitions ? (i + 1) * PartitionSize : NumObjects;
+
+				for (ObjectsIterator It(i * PartitionSize), End(PartitionEnd); It != End; ++It)
+					Callback(*It, Accumulators[i]);
+			}
+		}
+		catch (...)
+		{
+			std::scoped_lock Lock(ExceptionMutex);
+
+			if (!FirstException)
+				FirstException = std::current_exception();
+
+			bHasFailed = true;
+		}
+	};
+
+	int32 NumThreads = Settings::Generator::NumObjectArrayThreads > 0 ? Settings::Generator::NumObjectArrayThreads : static_cast<int32>(std::thread::hardware_concurrency());
+
+	if (ParallelForEachThreadLimit > 0 && NumThreads > ParallelForEachThreadLimit)
+		NumThreads = ParallelForEachThreadLimit;
+
+	if (NumThreads > NumPartitions)
+		NumThreads = NumPartitions;
+
+	std::vector<std::thread> Workers;
+
+	/* The calling thread acts as a worker too */
+	for (int32 i = 1; i < NumThreads; i++)
+		Workers.emplace_back(ProcessPartitionsWorker);
+
+	ProcessPartitionsWorker();
+
+	for (std::thread& Worker : Workers)
+		Worker.join();
+
+	if (FirstException)
+		std::rethrow_exception(FirstException);
+
+	return Accumulators;
+}
+
 #ifndef InitObjectArrayDecryption
 #define InitObjectArrayDecryption(DecryptionLambda) ObjectArray::InitDecryption(DecryptionLambda, #DecryptionLambda)
 #endif
@@ -0,0 +1,476 @@
+#include <iostream>
+#include <fstream>
+#include <format>
+#include <charconv>
+#include <vector>
+
+#include "OffsetCache.h"
+#include "Utils.h"
+#include "Offsets.h"
+#include "ObjectArray.h"
+#include "NameArray.h"
+#include "Settings.h"
+
+
+/* Defined in ObjectArray.cpp, the same checks used to find GObjects */
+bool IsAddressValidGObjects(const uintptr_t Address, const FFixedUObjectArrayLayout& Layout);
+bool IsAddressValidGObjects(const uintptr_t Address, const FChunkedFixedUObjectArrayLayout& Layout);
+
+
+namespace OffsetCacheUtils
+{
+	/* A variable stored in the cache, named by its fully qualified name */
+	class CachedValue
+	{
+	private:
+		const char* Name;
+
+		int32* IntValue = nullptr;
+		bool* BoolValue = nullptr;
+
+	public:
+		inline CachedValue(const char* InName, int32& Value)
+			: Name(InName), IntValue(&Value)
+		{
+		}
+
+		inline CachedValue(const char* InName, bool& Value)
+			: Name(InName), BoolValue(&Value)
+		{
+		}
+
+	public:
+		inline const char* GetName() const
+		{
+			return Name;
+		}
+
+		/* Negative offsets, like OffsetFinder::OffsetNotFound, are stored as uint32 */
+		inline uint64 Get() const
+		{
+			return IntValue ? static_cast<uint32>(*IntValue) : static_cast<uint64>(*BoolValue);
+		}
+
+		inline void Set(uint64 Value) const
+		{
+			if (IntValue)
+			{
+				*IntValue = static_cast<int32>(static_cast<uint32>(Value));
+			}
+			else
+			{
+				*BoolValue = Value != 0x0;
+			}
+		}
+	};
+
+#define CACHED_VALUE(Variable) OffsetCacheUtils::CachedValue(#Variable, Variable)
+
+	/* Everything set by Generator::InitEngineCore() before InitSettings(), which only depends on the game-binary */
+	inline const std::vector<CachedValue>& GetCachedValues()
+	{
+		static const std::vector<CachedValue> CachedValues =
+		{
+			CACHED_VALUE(Settings::Internal::bIsEnumNameOnly),
+			CACHED_VALUE(Settings::Internal::bIsSmallEnumValue),
+			CACHED_VALUE(Settings::Internal::bUseFProperty),
+			CACHED_VALUE(Settings::Internal::bUseNamePool),
+			CACHED_VALUE(Settings::Internal::bIsObjectNameBeforeClass),
+			CACHED_VALUE(Settings::Internal::bUseCasePreservingName),
+			CACHED_VALUE(Settings::Internal::bUseOutlineNumberName),
+			CACHED_VALUE(Settings::Internal::bUseMaskForFieldOwner),
+
+			CACHED_VALUE(Off::InSDK::ProcessEvent::PEIndex),
+			CACHED_VALUE(Off::InSDK::ProcessEvent::PEOffset),
+			CACHED_VALUE(Off::InSDK::World::GWorld),
+			CACHED_VALUE(Off::InSDK::ObjArray::GObjects),
+			CACHED_VALUE(Off::InSDK::ObjArray::ChunkSize),
+			CACHED_VALUE(Off::InSDK::ObjArray::FUObjectItemSize),
+			CACHED_VALUE(Off::InSDK::ObjArray::FUObjectItemInitialOffset),
+			CACHED_VALUE(Off::InSDK::Name::bIsUsingAppendStringOverToString),
+			CACHED_VALUE(Off::InSDK::Name::AppendNameToString),
+			CACHED_VALUE(Off::InSDK::Name::FNameSize),
+			CACHED_VALUE(Off::InSDK::NameArray::GNames),
+			CACHED_VALUE(Off::InSDK::NameArray::FNamePoolBlockOffsetBits),
+			CACHED_VALUE(Off::InSDK::NameArray::FNameEntryStride),
+			CACHED_VALUE(Off::InSDK::Properties::PropertySize),
+			CACHED_VALUE(Off::InSDK::Text::TextDatOffset),
+			CACHED_VALUE(Off::InSDK::Text::InTextDataStringOffset),
+			CACHED_VALUE(Off::InSDK::Text::TextSize),
+			CACHED_VALUE(Off::InSDK::ULevel::Actors),
+			CACHED_VALUE(Off::InSDK::UDataTable::RowMap),
+
+			CACHED_VALUE(Off::FUObjectArray::bIsChunked),
+			CACHED_VALUE(Off::FUObjectArray::FixedLayout.ObjectsOffset),
+			CACHED_VALUE(Off::FUObjectArray::FixedLayout.MaxObjectsOffset),
+			CACHED_VALUE(Off::FUObjectArray::FixedLayout.NumObjectsOffset),
+			CACHED_VALUE(Off::FUObjectArray::ChunkedFixedLayout.ObjectsOffset),
+			CACHED_VALUE(Off::FUObjectArray::ChunkedFixedLayout.MaxElementsOffset),
+			CACHED_VALUE(Off::FUObjectArray::ChunkedFixedLayout.NumElementsOffset),
+			CACHED_VALUE(Off::FUObjectArray::ChunkedFixedLayout.MaxChunksOffset),
+			CACHED_VALUE(Off::FUObjectArray::ChunkedFixedLayout.NumChunksOffset),
+
+			CACHED_VALUE(Off::NameArray::ChunksStart),
+			CACHED_VALUE(Off::NameArray::MaxChunkIndex),
+			CACHED_VALUE(Off::NameArray::NumElements),
+			CACHED_VALUE(Off::NameArray::ByteCursor),
+
+			CACHED_VALUE(Off::FField::Vft),
+			CACHED_VALUE(Off::FField::Class),
+			CACHED_VALUE(Off::FField::Owner),
+			CACHED_VALUE(Off::FField::Next),
+			CACHED_VALUE(Off::FField::Name),
+			CACHED_VALUE(Off::FField::Flags),
+
+			CACHED_VALUE(Off::FFieldClass::Name),
+			CACHED_VALUE(Off::FFieldClass::Id),
+			CACHED_VALUE(Off::FFieldClass::CastFlags),
+			CACHED_VALUE(Off::FFieldClass::ClassFlags),
+			CACHED_VALUE(Off::FFieldClass::SuperClass),
+
+			CACHED_VALUE(Off::FName::CompIdx),
+			CACHED_VALUE(Off::FName::Number),
+
+			CACHED_VALUE(Off::FNameEntry::NameArray::StringOffset),
+			CACHED_VALUE(Off::FNameEntry::NameArray::IndexOffset),
+			CACHED_VALUE(Off::FNameEntry::NamePool::HeaderOffset),
+			CACHED_VALUE(Off::FNameEntry::NamePool::StringOffset),
+
+			CACHED_VALUE(Off::UObject::Vft),
+			CACHED_VALUE(Off::UObject::Flags),
+			CACHED_VALUE(Off::UObject::Index),
+			CACHED_VALUE(Off::UObject::Class),
+			CACHED_VALUE(Off::UObject::Name),
+			CACHED_VALUE(Off::UObject::Outer),
+
+			CACHED_VALUE(Off::UField::Next),
+			CACHED_VALUE(Off::UEnum::Names),
+
+			CACHED_VALUE(Off::UStruct::SuperStruct),
+			CACHED_VALUE(Off::UStruct::Children),
+			CACHED_VALUE(Off::UStruct::ChildProperties),
+			CACHED_VALUE(Off::UStruct::Size),
+			CACHED_VALUE(Off::UStruct::MinAlignemnt),
+
+			CACHED_VALUE(Off::UFunction::FunctionFlags),
+			CACHED_VALUE(Off::UFunction::ExecFunction),
+
+			CACHED_VALUE(Off::UClass::CastFlags),
+			CACHED_VALUE(Off::UClass::ClassDefaultObject),
+
+			CACHED_VALUE(Off::Property::ArrayDim),
+			CACHED_VALUE(Off::Property::ElementSize),
+			CACHED_VALUE(Off::Property::PropertyFlags),
+			CACHED_VALUE(Off::Property::Offset_Internal),
+
+			CACHED_VALUE(Off::ByteProperty::Enum),
+			CACHED_VALUE(Off::BoolProperty::Base),
+			CACHED_VALUE(Off::ObjectProperty::PropertyClass),
+			CACHED_VALUE(Off::ClassProperty::MetaClass),
+			CACHED_VALUE(Off::StructProperty::Struct),
+			CACHED_VALUE(Off::ArrayProperty::Inner),
+			CACHED_VALUE(Off::DelegateProperty::SignatureFunction),
+			CACHED_VALUE(Off::MapProperty::Base),
+			CACHED_VALUE(Off::SetProperty::ElementProp),
+			CACHED_VALUE(Off::EnumProperty::Base),
+			CACHED_VALUE(Off::FieldPathProperty::FieldClass),
+			CACHED_VALUE(Off::OptionalProperty::ValueProperty),
+
+			CACHED_VALUE(PropertySizes::DelegateProperty),
+			CACHED_VALUE(PropertySizes::FieldPathProperty),
+		};
+
+		return CachedValues;
+	}
+
+#undef CACHED_VALUE
+
+	inline std::vector<uint64> CaptureValues()
+	{
+		std::vector<uint64> Values;
+		Values.reserve(GetCachedValues().size());
+
+		for (const CachedValue& Value : GetCachedValues())
+			Values.push_back(Value.Get());
+
+		return Values;
+	}
+
+	inline void ApplyValues(const std::vector<uint64>& Values)
+	{
+		const std::vector<CachedValue>& CachedValues = GetCachedValues();
+
+		for (size_t i = 0; i < CachedValues.size(); i++)
+			CachedValues[i].Set(Values[i]);
+	}
+}
+
+
+OffsetCache::ModuleFingerprint OffsetCache::GetFingerprint()
+{
+	constexpr uint64 FNVOffsetBasis = 0xCBF29CE484222325;
+	constexpr uint64 FNVPrime = 0x100000001B3;
+
+	const uintptr_t ImageBase = GetModuleBase();
+
+	const PIMAGE_DOS_HEADER DosHeader = reinterpret_cast<PIMAGE_DOS_HEADER>(ImageBase);
+	const PIMAGE_NT_HEADERS NtHeaders = reinterpret_cast<PIMAGE_NT_HEADERS>(ImageBase + DosHeader->e_lfanew);
+
+	/* Addresses and sizes of the sections change with almost every build, even if SizeOfImage doesn't */
+	const uint8* SectionHeaders = reinterpret_cast<const uint8*>(IMAGE_FIRST_SECTION(NtHeaders));
+	const size_t SectionHeadersSize = NtHeaders->FileHeader.NumberOfSections * sizeof(IMAGE_SECTION_HEADER);
+
+	uint64 SectionHash = FNVOffsetBasis;
+
+	for (size_t i = 0; i < SectionHeadersSize; i++)
+	{
+		SectionHash ^= SectionHeaders[i];
+		SectionHash *= FNVPrime;
+	}
+
+	return { NtHeaders->OptionalHeader.SizeOfImage, NtHeaders->FileHeader.TimeDateStamp, SectionHash };
+}
+
+fs::path OffsetCache::GetCachePath()
+{
+	wchar_t ExecutablePath[MAX_PATH] = { 0 };
+	GetModuleFileNameW(nullptr, ExecutablePath, MAX_PATH);
+
+	return fs::path(Settings::Generator::SDKGenerationPath) / CacheFolderName / fs::path(ExecutablePath).filename().replace_extension(".txt");
+}
+
+bool OffsetCache::Load(std::unordered_map<std::string, uint64>& OutValues)
+{
+	std::ifstream CacheFile(GetCachePath());
+
+	if (!CacheFile.is_open())
+		return false;
+
+	/* One line per value, "<value as hex> <name>" */
+	std::string Line;
+	while (std::getline(CacheFile, Line))
+	{
+		const size_t SeparatorPos = Line.find(' ');
+
+		/* A single damaged line could leave a stale offset behind, so the whole cache is discarded */
+		if (SeparatorPos == std::string::npos)
+		{
+			OutValues.clear();
+			return false;
+		}
+
+		uint64 Value = 0x0;
+		const auto [ValueEnd, Error] = std::from_chars(Line.data(), Line.data() + SeparatorPos, Value, 16);
+
+		if (Error != std::errc() || ValueEnd != (Line.data() + SeparatorPos))
+		{
+			OutValues.clear();
+			return false;
+		}
+
+		OutValues[Line.substr(SeparatorPos + 1)] = Value;
+	}
+
+	return true;
+}
+
+bool OffsetCache::ValidateAppliedOffsets(int32 CachedPEOffset)
+{
+	if (Off::InSDK::ProcessEvent::PEOffset != CachedPEOffset)
+		return false;
+
+	/* The first object is always the package of the CoreUObject module */
+	const UEObject FirstObject = ObjectArray::GetByIndex(0x0);
+
+	if (!FirstObject || FirstObject.GetIndex() != 0x0 || FirstObject.GetName() != "/Script/CoreUObject" || FirstObject.GetClass().GetName() != "Package")
+		return false;
+
+	const UEClass StructClass = ObjectArray::FindClassFast("Struct");
+	const UEClass ClassClass = ObjectArray::FindClassFast("Class");
+
+	if (!StructClass || !ClassClass || ClassClass.GetSuper() != StructClass || StructClass.GetSuper().GetName() != "Field")
+		return false;
+
+	/* Checks the property-offsets, AActor::RootComponent exists in every engine version */
+	if (const UEClass ActorClass = ObjectArray::FindClassFast("Actor"))
+	{
+		const UEProperty RootComponent = ActorClass.FindMember("RootComponent", EClassCastFlags::ObjectProperty);
+
+		if (!RootComponent || RootComponent.GetSize() != sizeof(void*))
+			return false;
+	}
+
+	return true;
+}
+
+void OffsetCache::ResetRuntimeState()
+{
+	FName::AppendString = nullptr;
+	FName::ToStr = nullptr;
+
+	NameArray::GNames = nullptr;
+
+	ObjectArray::GObjects = nullptr;
+	ObjectArray::ByIndex = nullptr;
+	ObjectArray::NumElementsPerChunk = 0x10000;
+	ObjectArray::SizeOfFUObjectItem = 0x18;
+	ObjectArray::FUObjectItemInitialOffset = 0x0;
+
+	/* Built by the FindObject* and IsA calls of ValidateAppliedOffsets(), from offsets which turned out to be wrong */
+	{
+		std::scoped_lock Lock(ObjectArray::LookupIndexMutex);
+		ObjectArray::LookupIndex = ObjectArray::ObjectLookupIndex();
+	}
+	{
+		std::unique_lock Lock(ObjectArray::HierarchyIndexMutex);
+		ObjectArray::HierarchyIndex = ObjectArray::ClassHierarchyIndex();
+		ObjectArray::bIsHierarchyIndexFrozen = false;
+	}
+}
+
+bool OffsetCache::TryInitFromCache()
+{
+	if constexpr (!Settings::Generator::bUseOffsetCache)
+		return false;
+
+	std::unordered_map<std::string, uint64> CachedValues;
+
+	if (!Load(CachedValues))
+		return false;
+
+	const ModuleFingerprint Fingerprint = GetFingerprint();
+
+	auto HasValue = [&CachedValues](const char* Name, uint64 ExpectedValue) -> bool
+	{
+		auto It = CachedValues.find(Name);
+
+		return It != CachedValues.end() && It->second == ExpectedValue;
+	};
+
+	if (!HasValue("OffsetCache::Version", CacheVersion) || !HasValue("Fingerprint::ImageSize", Fingerprint.ImageSize)
+		|| !HasValue("Fingerprint::TimeDateStamp", Fingerprint.TimeDateStamp) || !HasValue("Fingerprint::SectionHash", Fingerprint.SectionHash))
+	{
+		std::cout << "Offset-cache is outdated, the game-binary changed. Discovering offsets...\n\n";
+		return false;
+	}
+
+	std::vector<uint64> NewValues;
+	NewValues.reserve(OffsetCacheUtils::GetCachedValues().size());
+
+	for (const OffsetCacheUtils::CachedValue& Value : OffsetCacheUtils::GetCachedValues())
+	{
+		auto It = CachedValues.find(Value.GetName());
+
+		if (It == CachedValues.end())
+			return false;
+
+		NewValues.push_back(It->second);
+	}
+
+	const std::vector<uint64> DefaultValues = OffsetCacheUtils::CaptureValues();
+
+	auto RejectCache = [&DefaultValues](const char* Reason) -> bool
+	{
+		std::cout << std::format("Offset-cache was rejected, {}. Discovering offsets...\n\n", Reason);
+
+		OffsetCacheUtils::ApplyValues(DefaultValues);
+		ResetRuntimeState();
+
+		return false;
+	};
+
+	OffsetCacheUtils::ApplyValues(NewValues);
+
+	const uintptr_t ImageBase = GetModuleBase();
+	const uintptr_t GObjectsAddress = ImageBase + Off::InSDK::ObjArray::GObjects;
+
+	const bool bIsValidGObjects = Off::FUObjectArray::bIsChunked
+		? IsAddressValidGObjects(GObjectsAddress, Off::FUObjectArray::ChunkedFixedLayout)
+		: IsAddressValidGObjects(GObjectsAddress, Off::FUObjectArray::FixedLayout);
+
+	if (!bIsValidGObjects)
+		return RejectCache("GObjects is invalid");
+
+	std::cout << "Initializing from offset-cache...\n\n";
+
+	if (Off::FUObjectArray::bIsChunked)
+	{
+		ObjectArray::Init(Off::InSDK::ObjArray::GObjects, Off::InSDK::ObjArray::ChunkSize, Off::FUObjectArray::ChunkedFixedLayout);
+	}
+	else
+	{
+		ObjectArray::Init(Off::InSDK::ObjArray::GObjects, Off::FUObjectArray::FixedLayout);
+	}
+
+	/* GNames is always stored, but only used if neither FName::AppendString nor FName::ToString were found */
+	if (Off::InSDK::Name::AppendNameToString != 0x0)
+	{
+		const uintptr_t ImageSize = GetImageBaseAndSize().second;
+
+		if (static_cast<uint32>(Off::InSDK::Name::AppendNameToString) >= ImageSize)
+			return RejectCache("FName::AppendString is outside of the image");
+
+		const auto OverrideType = Off::InSDK::Name::bIsUsingAppendStringOverToString ? FName::EOffsetOverrideType::AppendString : FName::EOffsetOverrideType::ToString;
+
+		FName::Init(Off::InSDK::Name::AppendNameToString, OverrideType);
+	}
+	else
+	{
+		FName::Init(Off::InSDK::NameArray::GNames, FName::EOffsetOverrideType::GNames, Settings::Internal::bUseNamePool);
+	}
+
+	if (!FName::ToStr)
+		return RejectCache("FNames can't be resolved");
+
+	/* The overrides above recalculate some of the values, the cached ones are what the discovery ended up with */
+	OffsetCacheUtils::ApplyValues(NewValues);
+
+	::NameArray::PostInit();
+
+	const int32 CachedPEOffset = Off::InSDK::ProcessEvent::PEOffset;
+	Off::InSDK::ProcessEvent::InitPE(Off::InSDK::ProcessEvent::PEIndex);
+
+	if (!ValidateAppliedOffsets(CachedPEOffset))
+		return RejectCache("the cached offsets don't match the game");
+
+	/* No UWorld might have existed during the run that created the cache */
+	if (Off::InSDK::World::GWorld == 0x0)
+		Off::InSDK::World::InitGWorld();
+
+	std::cout << "Initialized all offsets from the offset-cache.\n\n";
+
+	return true;
+}
+
+void OffsetCache::Save()
+{
+	if constexpr (!Settings::Generator::bUseOffsetCache)
+		return;
+
+	/* Don't store results of a failed discovery, the next run should try again */
+	if (Off::InSDK::ObjArray::GObjects == 0x0 || Off::InSDK::ProcessEvent::PEIndex == 0x0)
+		return;
+
+	const fs::path CachePath = GetCachePath();
+
+	std::error_code ErrorCode;
+	fs::create_directories(CachePath.parent_path(), ErrorCode);
+
+	std::ofstream CacheFile(CachePath);
+
+	if (!CacheFile.is_open())
+	{
+		std::cout << "Error opening the offset-cache file in \"" << CacheFolderName << "\"" << std::endl;
+		return;
+	}
+
+	const ModuleFingerprint Fingerprint = GetFingerprint();
+
+	CacheFile << std::format("{:016X} {}\n", CacheVersion, "OffsetCache::Version");
+	CacheFile << std::format("{:016X} {}\n", Fingerprint.ImageSize, "Fingerprint::ImageSize");
+	CacheFile << std::format("{:016X} {}\n", Fingerprint.TimeDateStamp, "Fingerprint::TimeDateStamp");
+	CacheFile << std::format("{:016X} {}\n", Fingerprint.SectionHash, "Fingerprint::SectionHash");
+
+	for (const OffsetCacheUtils::CachedValue& Value : OffsetCacheUtils::GetCachedValues())
+		CacheFile << std::format("{:016X} {}\n", Value.Get(), Value.GetName());
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <filesystem>
+
+#include "Enums.h"
+
+namespace fs = std::filesystem;
+
+
+/*
+* Stores the results of Generator::InitEngineCore() (GObjects, FName, Off::Init(), PropertySizes, ProcessEvent, GWorld, FText and Settings::Internal)
+* in 'SDKGenerationPath/OffsetCache/<ExecutableName>.txt', so they don't need to be discovered again while the game-binary stays the same.
+*
+* The cache is keyed by a fingerprint of the executable (SizeOfImage, TimeDateStamp and a hash of the section-headers). Cached offsets are
+* validated with a few spot-checks (GObjects-layout, names of well known objects, ProcessEvent), everything is discovered again if any of them fails.
+*/
+class OffsetCache
+{
+private:
+	/* Increased whenever values are added to, or removed from, the cache */
+	static constexpr uint64 CacheVersion = 0x1;
+
+	static constexpr const char* CacheFolderName = "OffsetCache";
+
+private:
+	struct ModuleFingerprint
+	{
+		uint64 ImageSize;
+		uint64 TimeDateStamp;
+		uint64 SectionHash;
+	};
+
+private:
+	static ModuleFingerprint GetFingerprint();
+	static fs::path GetCachePath();
+
+	/* Name -> value, as read from the cache-file */
+	static bool Load(std::unordered_map<std::string, uint64>& OutValues);
+
+	/* Checks whether the offsets that were just applied result in the expected objects and names */
+	static bool ValidateAppliedOffsets(int32 CachedPEOffset);
+
+	/* Resets the state changed by a rejected cache, so discovery starts from the same state as without a cache */
+	static void ResetRuntimeState();
+
+public:
+	/* Initializes everything from the cache, returns false if there's no valid cache for this game-binary */
+	static bool TryInitFromCache();
+
+	/* Stores all current offsets, must be called after they were discovered */
+	static void Save();
+};
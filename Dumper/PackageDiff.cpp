@@ -0,0 +1,441 @@
+#include <iostream>
+#include <fstream>
+#include <format>
+#include <algorithm>
+#include <charconv>
+
+#include "PackageDiff.h"
+#include "StructManager.h"
+#include "EnumManager.h"
+#include "ObjectArray.h"
+#include "CppGenerator.h"
+
+
+namespace PackageDiffUtils
+{
+	/* Incremental 64bit FNV-1a. Every value is terminated, so that "ab" + "c" and "a" + "bc" don't result in the same hash. */
+	class FingerprintHasher
+	{
+	private:
+		static constexpr uint64 FNVOffsetBasis = 0xCBF29CE484222325;
+		static constexpr uint64 FNVPrime = 0x100000001B3;
+
+	private:
+		uint64 Hash = FNVOffsetBasis;
+
+	private:
+		inline void AddBytes(const void* Data, size_t Size)
+		{
+			const uint8* Bytes = static_cast<const uint8*>(Data);
+
+			for (size_t i = 0; i < Size; i++)
+			{
+				Hash ^= Bytes[i];
+				Hash *= FNVPrime;
+			}
+		}
+
+	public:
+		inline void Add(std::string_view String)
+		{
+			AddBytes(String.data(), String.size());
+			AddBytes("", 0x1);
+		}
+
+		inline void Add(int64 Value)
+		{
+			AddBytes(&Value, sizeof(Value));
+		}
+
+		inline uint64 GetHash() const
+		{
+			return Hash;
+		}
+	};
+}
+
+void PackageDiff::AddMembers(PackageDiffUtils::FingerprintHasher& Hasher, const MemberManager& Members, int32 PackageIndex)
+{
+	/* Predefined members are part of the generated code too */
+	for (const PropertyWrapper& Member : Members.IterateMembers())
+	{
+		Hasher.Add(Member.GetName());
+		Hasher.Add(CppGenerator::GetMemberTypeString(Member, PackageIndex));
+		Hasher.Add(Member.GetOffset());
+		Hasher.Add(Member.GetSize());
+		Hasher.Add(Member.GetArrayDim());
+		Hasher.Add(static_cast<int64>(Member.GetPropertyFlags()));
+
+		if (Member.IsBitField())
+			Hasher.Add(Member.GetBitIndex());
+	}
+}
+
+void PackageDiff::AddStruct(PackageDiffUtils::FingerprintHasher& Hasher, UEStruct Struct, int32 PackageIndex)
+{
+	const StructWrapper Wrapper(Struct);
+	const StructInfoHandle Info = StructManager::GetInfo(Struct);
+
+	/* Names as CppGenerator emits them, 'Package::Name' if the name isn't unique */
+	Hasher.Add(CppGenerator::GetStructPrefixedName(Wrapper));
+	Hasher.Add(Info.GetSize());
+	Hasher.Add(Info.GetAlignment());
+
+	if (UEStruct Super = Struct.GetSuper())
+		Hasher.Add(CppGenerator::GetStructPrefixedName(StructWrapper(Super)));
+
+	const MemberManager Members = Wrapper.GetMembers();
+
+	AddMembers(Hasher, Members, PackageIndex);
+
+	for (const FunctionWrapper& Func : Members.IterateFunctions())
+	{
+		if (Func.IsPredefined())
+		{
+			Hasher.Add(Func.GetPredefFuncNameWithParams());
+			continue;
+		}
+
+		Hasher.Add(Func.GetName());
+		Hasher.Add(static_cast<int64>(Func.GetFunctionFlags()));
+
+		AddMembers(Hasher, Func.GetMembers(), PackageIndex);
+	}
+}
+
+void PackageDiff::AddFunction(PackageDiffUtils::FingerprintHasher& Hasher, UEFunction Function, int32 PackageIndex)
+{
+	/* Parameter-struct of the function, "OuterName_FunctionName" */
+	const StructWrapper Wrapper(Function);
+
+	Hasher.Add(CppGenerator::GetStructPrefixedName(Wrapper));
+	Hasher.Add(static_cast<int64>(Function.GetFunctionFlags()));
+
+	AddMembers(Hasher, Wrapper.GetMembers(), PackageIndex);
+}
+
+void PackageDiff::AddEnum(PackageDiffUtils::FingerprintHasher& Hasher, UEEnum Enum)
+{
+	const EnumWrapper Wrapper(Enum);
+
+	Hasher.Add(CppGenerator::GetEnumPrefixedName(Wrapper));
+	Hasher.Add(Wrapper.GetUnderlyingTypeSize());
+
+	for (const EnumCollisionInfo& Info : Wrapper.GetMembers())
+	{
+		Hasher.Add(Info.GetUniqueName());
+		Hasher.Add(static_cast<int64>(Info.GetValue()));
+	}
+}
+
+void PackageDiff::AddDependencies(PackageDiffUtils::FingerprintHasher& Hasher, PackageInfoHandle Package)
+{
+	/* Includes and enum forward-declarations as they are after PackageManager::HandleCycles(). Sorted, as package- and object-indices change between runs. */
+	std::vector<std::string> Entries;
+
+	auto AddDependencyList = [&Entries](const char* FileName, const DependencyListType& Dependencies) -> void
+	{
+		for (const auto& [Index, Requirements] : Dependencies)
+			Entries.push_back(std::format("{} {} {:d}{:d}", FileName, PackageManager::GetName(Requirements.PackageIdx), Requirements.bShouldIncludeStructs, Requirements.bShouldIncludeClasses));
+	};
+
+	const DependencyInfo& Dependencies = Package.GetPackageDependencies();
+
+	AddDependencyList("structs", Dependencies.StructsDependencies);
+	AddDependencyList("classes", Dependencies.ClassesDependencies);
+	AddDependencyList("parameters", Dependencies.ParametersDependencies);
+
+	for (const auto& [EnumIdx, bIsForClassFile] : Package.GetEnumForwardDeclarations())
+		Entries.push_back(std::format("enum {} {:d}", CppGenerator::GetEnumPrefixedName(EnumWrapper(ObjectArray::GetByIndex<UEEnum>(EnumIdx))), bIsForClassFile));
+
+	std::sort(Entries.begin(), Entries.end());
+
+	for (const std::string& Entry : Entries)
+		Hasher.Add(Entry);
+}
+
+uint64 PackageDiff::CalculateSettingsFingerprint()
+{
+	PackageDiffUtils::FingerprintHasher Hasher;
+
+	/* nullptr and "" are different settings, eg. for SDKNamespaceName */
+	auto AddOptionalString = [&Hasher](const char* String) -> void
+	{
+		Hasher.Add(String != nullptr);
+		Hasher.Add(String ? String : "");
+	};
+
+	Hasher.Add(FingerprintVersion);
+
+	AddOptionalString(Settings::CppGenerator::FilePrefix);
+	AddOptionalString(Settings::CppGenerator::SDKNamespaceName);
+	AddOptionalString(Settings::CppGenerator::ParamNamespaceName);
+	AddOptionalString(Settings::CppGenerator::XORString);
+	Hasher.Add(Settings::CppGenerator::bForceNoGWorldInSDK);
+	Hasher.Add(Settings::CppGenerator::bAddManualOverrideOptions);
+
+	Hasher.Add(Settings::Debug::bGenerateInlineAssertionsForStructSize);
+	Hasher.Add(Settings::Debug::bGenerateInlineAssertionsForStructMembers);
+
+	Hasher.Add(Settings::EngineCore::bCheckEnumNamesInUEnum);
+
+	Hasher.Add(Settings::Internal::bIsEnumNameOnly);
+	Hasher.Add(Settings::Internal::bIsSmallEnumValue);
+	Hasher.Add(Settings::Internal::bIsWeakObjectPtrWithoutTag);
+	Hasher.Add(Settings::Internal::bUseFProperty);
+	Hasher.Add(Settings::Internal::bUseNamePool);
+	Hasher.Add(Settings::Internal::bIsObjectNameBeforeClass);
+	Hasher.Add(Settings::Internal::bUseCasePreservingName);
+	Hasher.Add(Settings::Internal::bUseOutlineNumberName);
+	Hasher.Add(Settings::Internal::bUseMaskForFieldOwner);
+	Hasher.Add(Settings::Internal::bUseLargeWorldCoordinates);
+
+	return Hasher.GetHash();
+}
+
+uint64 PackageDiff::CalculateFingerprint(PackageInfoHandle Package)
+{
+	PackageDiffUtils::FingerprintHasher Hasher;
+
+	const int32 PackageIndex = Package.GetIndex();
+
+	Hasher.Add(static_cast<int64>(SettingsFingerprint));
+	Hasher.Add(Package.GetName());
+
+	auto AddStructCallback = [&Hasher, PackageIndex](int32 Index) -> void
+	{
+		AddStruct(Hasher, ObjectArray::GetByIndex<UEStruct>(Index), PackageIndex);
+	};
+
+	Package.GetSortedStructs().VisitAllNodesWithCallback(AddStructCallback);
+	Package.GetSortedClasses().VisitAllNodesWithCallback(AddStructCallback);
+
+	for (const int32 FuncIdx : Package.GetFunctions())
+		AddFunction(Hasher, ObjectArray::GetByIndex<UEFunction>(FuncIdx), PackageIndex);
+
+	for (const int32 EnumIdx : Package.GetEnums())
+		AddEnum(Hasher, ObjectArray::GetByIndex<UEEnum>(EnumIdx));
+
+	AddDependencies(Hasher, Package);
+
+	return Hasher.GetHash();
+}
+
+void PackageDiff::ParseFingerprints(std::istream& Input, std::unordered_map<std::string, uint64>& OutFingerprints)
+{
+	std::string Line;
+	while (std::getline(Input, Line))
+	{
+		const size_t SeparatorPos = Line.find(' ');
+
+		if (SeparatorPos == std::string::npos || (SeparatorPos + 1) >= Line.size())
+			continue;
+
+		uint64 Fingerprint = 0x0;
+		const auto [FingerprintEnd, Error] = std::from_chars(Line.data(), Line.data() + SeparatorPos, Fingerprint, 16);
+
+		/* Damaged lines are ignored, their packages are treated as added and regenerated */
+		if (Error != std::errc() || FingerprintEnd != (Line.data() + SeparatorPos))
+			continue;
+
+		OutFingerprints[Line.substr(SeparatorPos + 1)] = Fingerprint;
+	}
+}
+
+void PackageDiff::LoadFingerprints()
+{
+	std::ifstream Fingerprints(RootFolder / FingerprintsFileName);
+
+	if (!Fingerprints.is_open())
+		return;
+
+	bHasPreviousFingerprints = true;
+
+	/* One line per package, "<fingerprint as hex> <package name>" */
+	ParseFingerprints(Fingerprints, PreviousFingerprints);
+}
+
+void PackageDiff::SaveFingerprints()
+{
+	std::ofstream Fingerprints(RootFolder / FingerprintsFileName);
+
+	if (!Fingerprints.is_open())
+	{
+		std::cout << "Error opening file \"" << FingerprintsFileName << "\"" << std::endl;
+		return;
+	}
+
+	for (const auto& [PackageName, Fingerprint] : CurrentFingerprints)
+		Fingerprints << std::format("{:016X} {}\n", Fingerprint, PackageName);
+}
+
+void PackageDiff::WriteReport()
+{
+	std::ofstream Report(RootFolder / ReportFileName);
+
+	if (!Report.is_open())
+	{
+		std::cout << "Error opening file \"" << ReportFileName << "\"" << std::endl;
+		return;
+	}
+
+	if (!bHasPreviousFingerprints)
+	{
+		Report << "No fingerprints from a previous run were found, all packages were generated.\n";
+		return;
+	}
+
+	auto WriteSection = [&Report](const char* Title, std::vector<std::string>& PackageNames) -> void
+	{
+		std::sort(PackageNames.begin(), PackageNames.end());
+
+		Report << std::format("{} ({}):\n", Title, PackageNames.size());
+
+		for (const std::string& Name : PackageNames)
+			Report << std::format("\t{}\n", Name);
+
+		Report << "\n";
+	};
+
+	WriteSection("Added", AddedPackages);
+	WriteSection("Removed", RemovedPackages);
+	WriteSection("Changed", ChangedPackages);
+	WriteSection("Regenerated due to changed dependencies", AffectedPackages);
+
+	Report << std::format("Unchanged: {}\n", CurrentFingerprints.size() - PackagesToRegenerate.size());
+}
+
+void PackageDiff::Begin(const fs::path& InRootFolder)
+{
+	RootFolder = InRootFolder;
+
+	PreviousFingerprints.clear();
+	CurrentFingerprints.clear();
+	PackagesToRegenerate.clear();
+
+	AddedPackages.clear();
+	RemovedPackages.clear();
+	ChangedPackages.clear();
+	AffectedPackages.clear();
+
+	bHasPreviousFingerprints = false;
+
+	SettingsFingerprint = CalculateSettingsFingerprint();
+
+	LoadFingerprints();
+
+	std::unordered_set<int32> ChangedPackageIndices;
+
+	for (PackageInfoHandle Package : PackageManager::IterateOverPackageInfos())
+	{
+		if (Package.IsEmpty())
+			continue;
+
+		const std::string PackageName = Package.GetName();
+		const uint64 Fingerprint = CalculateFingerprint(Package);
+
+		CurrentFingerprints[PackageName] = Fingerprint;
+
+		auto It = PreviousFingerprints.find(PackageName);
+
+		if (It == PreviousFingerprints.end())
+		{
+			AddedPackages.push_back(PackageName);
+			ChangedPackageIndices.insert(Package.GetIndex());
+		}
+		else if (It->second != Fingerprint)
+		{
+			ChangedPackages.push_back(PackageName);
+			ChangedPackageIndices.insert(Package.GetIndex());
+		}
+	}
+
+	for (const auto& [PackageName, Fingerprint] : PreviousFingerprints)
+	{
+		if (!CurrentFingerprints.contains(PackageName))
+			RemovedPackages.push_back(PackageName);
+	}
+
+	/* Packages including a package, or forward declaring enums from it, depend on it */
+	std::unordered_map<int32, std::vector<int32>> Dependents;
+
+	auto AddDependents = [&Dependents](int32 DependentPackage, const DependencyListType& Dependencies) -> void
+	{
+		for (const auto& [Index, Requirements] : Dependencies)
+		{
+			if (Requirements.PackageIdx != DependentPackage)
+				Dependents[Requirements.PackageIdx].push_back(DependentPackage);
+		}
+	};
+
+	for (PackageInfoHandle Package : PackageManager::IterateOverPackageInfos())
+	{
+		if (Package.IsEmpty())
+			continue;
+
+		const int32 PackageIndex = Package.GetIndex();
+		const DependencyInfo& Dependencies = Package.GetPackageDependencies();
+
+		AddDependents(PackageIndex, Dependencies.StructsDependencies);
+		AddDependents(PackageIndex, Dependencies.ClassesDependencies);
+		AddDependents(PackageIndex, Dependencies.ParametersDependencies);
+
+		for (const auto& [EnumIdx, bIsClass] : Package.GetEnumForwardDeclarations())
+		{
+			const int32 EnumPackageIndex = ObjectArray::GetByIndex(EnumIdx).GetPackageIndex();
+
+			if (EnumPackageIndex != PackageIndex)
+				Dependents[EnumPackageIndex].push_back(PackageIndex);
+		}
+	}
+
+	PackagesToRegenerate = CollectPackagesToRegenerate(ChangedPackageIndices, Dependents);
+
+	for (const int32 PackageIndex : PackagesToRegenerate)
+	{
+		if (!ChangedPackageIndices.contains(PackageIndex))
+			AffectedPackages.push_back(PackageManager::GetName(PackageIndex));
+	}
+
+	if (bHasPreviousFingerprints)
+	{
+		std::cout << std::format("Package-diff: {} added, {} removed, {} changed and {} affected by changed dependencies.\n",
+			AddedPackages.size(), RemovedPackages.size(), ChangedPackages.size(), AffectedPackages.size()) << std::endl;
+	}
+}
+
+std::unordered_set<int32> PackageDiff::CollectPackagesToRegenerate(const std::unordered_set<int32>& ChangedPackages, const std::unordered_map<int32, std::vector<int32>>& Dependents)
+{
+	std::unordered_set<int32> RegeneratedPackages = ChangedPackages;
+	std::vector<int32> PackagesToVisit(ChangedPackages.begin(), ChangedPackages.end());
+
+	while (!PackagesToVisit.empty())
+	{
+		const int32 PackageIndex = PackagesToVisit.back();
+		PackagesToVisit.pop_back();
+
+		auto It = Dependents.find(PackageIndex);
+
+		if (It == Dependents.end())
+			continue;
+
+		for (const int32 Dependent : It->second)
+		{
+			if (RegeneratedPackages.insert(Dependent).second)
+				PackagesToVisit.push_back(Dependent);
+		}
+	}
+
+	return RegeneratedPackages;
+}
+
+void PackageDiff::End()
+{
+	SaveFingerprints();
+	WriteReport();
+}
+
+bool PackageDiff::ShouldRegeneratePackage(int32 PackageIndex)
+{
+	return !bHasPreviousFingerprints || PackagesToRegenerate.contains(PackageIndex);
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+#include <filesystem>
+#include <istream>
+
+#include "Enums.h"
+#include "PackageManager.h"
+#include "MemberManager.h"
+
+namespace fs = std::filesystem;
+
+namespace PackageDiffUtils
+{
+	class FingerprintHasher;
+}
+
+
+/*
+* Compares the reflection data of every package against the previous run, to only regenerate packages that changed with a game update.
+*
+* A fingerprint is calculated from the contents of each package, as CppGenerator emits them (collision-resolved struct-, member- and enum-names, sizes, offsets,
+* member-types, function-signatures and enum-values), its includes and enum forward-declarations after cycles were broken, and the settings affecting the output.
+* Fingerprints are stored in 'PackageFingerprints.txt'. Packages are regenerated if their fingerprint changed, or if they depend on such a package, directly or
+* through other packages. A summary of the changes is written to 'PackageChanges.txt'.
+*/
+class PackageDiff
+{
+private:
+	friend class PackageDiffTest;
+
+private:
+	static constexpr const char* FingerprintsFileName = "PackageFingerprints.txt";
+	static constexpr const char* ReportFileName = "PackageChanges.txt";
+
+	/* Part of every fingerprint. Increment when CppGenerator changes the code it generates for packages, so that all packages are regenerated once. */
+	static constexpr int64 FingerprintVersion = 0x2;
+
+private:
+	static inline fs::path RootFolder;
+
+	/* Unique package-name -> fingerprint */
+	static inline std::unordered_map<std::string, uint64> PreviousFingerprints;
+	static inline std::unordered_map<std::string, uint64> CurrentFingerprints;
+
+	/* Indices of packages which need to be regenerated */
+	static inline std::unordered_set<int32> PackagesToRegenerate;
+
+	/* Names of packages for the report */
+	static inline std::vector<std::string> AddedPackages;
+	static inline std::vector<std::string> RemovedPackages;
+	static inline std::vector<std::string> ChangedPackages;
+	static inline std::vector<std::string> AffectedPackages;
+
+	/* Fingerprint of FingerprintVersion and all settings affecting the generated packages, added to the fingerprint of every package */
+	static inline uint64 SettingsFingerprint = 0x0;
+
+	static inline bool bHasPreviousFingerprints = false;
+
+private:
+	/* Reads lines of "<fingerprint as hex> <package name>", malformed lines are ignored */
+	static void ParseFingerprints(std::istream& Input, std::unordered_map<std::string, uint64>& OutFingerprints);
+
+	static void LoadFingerprints();
+	static void SaveFingerprints();
+	static void WriteReport();
+
+	/* Returns 'ChangedPackages' and all packages depending on any of them, directly or through other packages. 'Dependents' maps a package to the packages depending on it. */
+	static std::unordered_set<int32> CollectPackagesToRegenerate(const std::unordered_set<int32>& ChangedPackages, const std::unordered_map<int32, std::vector<int32>>& Dependents);
+
+private:
+	static void AddMembers(PackageDiffUtils::FingerprintHasher& Hasher, const MemberManager& Members, int32 PackageIndex);
+	static void AddStruct(PackageDiffUtils::FingerprintHasher& Hasher, UEStruct Struct, int32 PackageIndex);
+	static void AddFunction(PackageDiffUtils::FingerprintHasher& Hasher, UEFunction Function, int32 PackageIndex);
+	static void AddEnum(PackageDiffUtils::FingerprintHasher& Hasher, UEEnum Enum);
+	static void AddDependencies(PackageDiffUtils::FingerprintHasher& Hasher, PackageInfoHandle Package);
+
+	static uint64 CalculateSettingsFingerprint();
+
+public:
+	/* Requires the SettingsFingerprint, which is calculated in Begin() */
+	static uint64 CalculateFingerprint(PackageInfoHandle Package);
+
+	/* Calculates the fingerprints of all packages and compares them to the ones stored in 'InRootFolder' by the previous run */
+	static void Begin(const fs::path& InRootFolder);
+
+	/* Stores the fingerprints for the next run and writes the change-report */
+	static void End();
+
+	/* True if the package changed, depends on a changed package, or if there were no fingerprints from a previous run */
+	static bool ShouldRegeneratePackage(int32 PackageIndex);
+};
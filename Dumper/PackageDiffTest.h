@@ -0,0 +1,107 @@
+#pragma once
+#include <sstream>
+
+#include "PackageDiff.h"
+#include "TestBase.h"
+
+
+class PackageDiffTest : protected TestBase
+{
+public:
+	template<bool bDoDebugPrinting = false>
+	static inline void TestAll()
+	{
+		TestParseFingerprints<bDoDebugPrinting>();
+		TestTransitiveInvalidation<bDoDebugPrinting>();
+		TestStableFingerprints<bDoDebugPrinting>();
+		PrintDbgMessage<bDoDebugPrinting>("");
+	}
+
+	template<bool bDoDebugPrinting = false>
+	static inline void TestParseFingerprints()
+	{
+		bool bSuccededTestWithoutError = true;
+
+		std::istringstream Input(
+			"00000000000000FF CoreUObject\n"
+			"\n"
+			"NoSeparator\n"
+			"XYZ Engine\n"
+			"12AB\n"
+			"12AB \n"
+			"1F UMG\n"
+			"10000000000000000 TooLarge\n"
+			"-1 Negative\n"
+			"1234abcd SlateCore\n"
+		);
+
+		std::unordered_map<std::string, uint64> Fingerprints;
+		PackageDiff::ParseFingerprints(Input, Fingerprints);
+
+		const std::unordered_map<std::string, uint64> ExpectedFingerprints = {
+			{ "CoreUObject", 0xFF },
+			{ "UMG", 0x1F },
+			{ "SlateCore", 0x1234ABCD },
+		};
+
+		SetBoolIfFailed(bSuccededTestWithoutError, Fingerprints == ExpectedFingerprints);
+
+		for (const auto& [PackageName, Fingerprint] : Fingerprints)
+			PrintDbgMessage<bDoDebugPrinting>("{} -> 0x{:X}", PackageName, Fingerprint);
+
+		std::cout << __FUNCTION__ << ": " << (bSuccededTestWithoutError ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
+	template<bool bDoDebugPrinting = false>
+	static inline void TestTransitiveInvalidation()
+	{
+		bool bSuccededTestWithoutError = true;
+
+		/* Package -> packages depending on it. 1 <- 2 <- 3 <- 1 is cyclic, 4 <- 5 is unrelated to the changed package. */
+		const std::unordered_map<int32, std::vector<int32>> Dependents = {
+			{ 1, { 2 } },
+			{ 2, { 3 } },
+			{ 3, { 1 } },
+			{ 4, { 5 } },
+		};
+
+		const std::unordered_set<int32> Regenerated = PackageDiff::CollectPackagesToRegenerate({ 1 }, Dependents);
+		SetBoolIfFailed(bSuccededTestWithoutError, Regenerated == std::unordered_set<int32>{ 1, 2, 3 });
+
+		const std::unordered_set<int32> RegeneratedFromLeaf = PackageDiff::CollectPackagesToRegenerate({ 5 }, Dependents);
+		SetBoolIfFailed(bSuccededTestWithoutError, RegeneratedFromLeaf == std::unordered_set<int32>{ 5 });
+
+		const std::unordered_set<int32> RegeneratedFromNone = PackageDiff::CollectPackagesToRegenerate({}, Dependents);
+		SetBoolIfFailed(bSuccededTestWithoutError, RegeneratedFromNone.empty());
+
+		std::cout << __FUNCTION__ << ": " << (bSuccededTestWithoutError ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
+	/* Requires the managers to be initialized, see Generator::InitInternal() */
+	template<bool bDoDebugPrinting = false>
+	static inline void TestStableFingerprints()
+	{
+		bool bSuccededTestWithoutError = true;
+
+		PackageDiff::SettingsFingerprint = PackageDiff::CalculateSettingsFingerprint();
+
+		SetBoolIfFailed(bSuccededTestWithoutError, PackageDiff::SettingsFingerprint == PackageDiff::CalculateSettingsFingerprint());
+
+		for (PackageInfoHandle Package : PackageManager::IterateOverPackageInfos())
+		{
+			if (Package.IsEmpty())
+				continue;
+
+			const uint64 FirstFingerprint = PackageDiff::CalculateFingerprint(Package);
+			const uint64 SecondFingerprint = PackageDiff::CalculateFingerprint(Package);
+
+			if (FirstFingerprint != SecondFingerprint)
+			{
+				PrintDbgMessage<bDoDebugPrinting>("Fingerprint of '{}' isn't stable: 0x{:X} != 0x{:X}", Package.GetName(), FirstFingerprint, SecondFingerprint);
+				bSuccededTestWithoutError = false;
+			}
+		}
+
+		std::cout << __FUNCTION__ << ": " << (bSuccededTestWithoutError ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+};
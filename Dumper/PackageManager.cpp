@@ -243,21 +243,62 @@ void PackageManager::InitDependencies()
 {
 	// Collects all packages required to compile this file
 
-	for (auto Obj : ObjectArray())
+	struct ObjectDependencies
+	{
+		int32 Index;
+
+		/* Empty for enums */
+		std::unordered_set<int32> Dependencies;
+		std::vector<std::pair<int32, std::unordered_set<int32>>> FunctionDependencies;
+	};
+
+	/* Gathering dependencies from properties is done in parallel, PackageInfos are only written to in GObjects-order below */
+	const auto Partitions = ObjectArray::ParallelForEach<std::vector<ObjectDependencies>>([](UEObject Obj, std::vector<ObjectDependencies>& OutDependencies)
 	{
 		if (Obj.HasAnyFlags(EObjectFlags::ClassDefaultObject))
-			continue;
+			return;
 
-		int32 CurrentPackageIdx = Obj.GetPackageIndex();
+		if (Obj.IsA(EClassCastFlags::Enum))
+		{
+			OutDependencies.push_back({ Obj.GetIndex() });
+			return;
+		}
+
+		if (!Obj.IsA(EClassCastFlags::Struct) || Obj.IsA(EClassCastFlags::Function))
+			return;
+
+		UEStruct ObjAsStruct = Obj.Cast<UEStruct>();
 
-		const bool bIsStruct = Obj.IsA(EClassCastFlags::Struct);
-		const bool bIsClass = Obj.IsA(EClassCastFlags::Class);
+		ObjectDependencies& Deps = OutDependencies.emplace_back();
+		Deps.Index = ObjAsStruct.GetIndex();
+		Deps.Dependencies = PackageManagerUtils::GetDependencies(ObjAsStruct, Deps.Index);
 
-		const bool bIsFunction = Obj.IsA(EClassCastFlags::Function);
-		const bool bIsEnum = Obj.IsA(EClassCastFlags::Enum);
+		if (!Obj.IsA(EClassCastFlags::Class))
+			return;
 
-		if (bIsStruct && !bIsFunction)
+		for (UEFunction Func : ObjAsStruct.GetFunctions())
+			Deps.FunctionDependencies.emplace_back(Func.GetIndex(), PackageManagerUtils::GetDependencies(Func, Func.GetIndex()));
+	});
+
+	for (const std::vector<ObjectDependencies>& ObjectsDependencies : Partitions)
+	{
+		for (const ObjectDependencies& Deps : ObjectsDependencies)
 		{
+			UEObject Obj = ObjectArray::GetByIndex(Deps.Index);
+
+			int32 CurrentPackageIdx = Obj.GetPackageIndex();
+
+			if (Obj.IsA(EClassCastFlags::Enum))
+			{
+				PackageInfo& Info = PackageInfos[CurrentPackageIdx];
+				Info.PackageIndex = CurrentPackageIdx;
+
+				Info.Enums.push_back(Obj.GetIndex());
+				continue;
+			}
+
+			const bool bIsClass = Obj.IsA(EClassCastFlags::Class);
+
 			PackageInfo& Info = PackageInfos[CurrentPackageIdx];
 			Info.PackageIndex = CurrentPackageIdx;
 
@@ -269,7 +310,7 @@ void PackageManager::InitDependencies()
 			DependencyListType& PackageDependencyList = bIsClass ? Info.PackageDependencies.ClassesDependencies : Info.PackageDependencies.StructsDependencies;
 			DependencyManager& ClassOrStructDependencyList = bIsClass ? Info.ClassesSorted : Info.StructsSorted;
 
-			std::unordered_set<int32> Dependencies = PackageManagerUtils::GetDependencies(ObjAsStruct, StructIdx);
+			const std::unordered_set<int32>& Dependencies = Deps.Dependencies;
 
 			ClassOrStructDependencyList.SetExists(StructIdx);
 
@@ -297,15 +338,12 @@ void PackageManager::InitDependencies()
 				}
 			}
 
-			if (!bIsClass)
-				continue;
-			
-			/* Add class-functions to package */
-			for (UEFunction Func : ObjAsStruct.GetFunctions())
+			/* Add class-functions to package, FunctionDependencies is empty for structs */
+			for (const auto& [FuncIndex, ParamDependencies] : Deps.FunctionDependencies)
 			{
-				Info.Functions.push_back(Func.GetIndex());
+				UEFunction Func = ObjectArray::GetByIndex<UEFunction>(FuncIndex);
 
-				std::unordered_set<int32> ParamDependencies = PackageManagerUtils::GetDependencies(Func, Func.GetIndex());
+				Info.Functions.push_back(FuncIndex);
 
 				BooleanOrEqual(Info.bHasParams, Func.HasMembers());
 
@@ -316,13 +354,13 @@ void PackageManager::InitDependencies()
 				PackageManagerUtils::AddEnumPackageDependencies(Info.PackageDependencies.ClassesDependencies, ParamDependencies, FuncPackageIndex, true);
 			}
 		}
-		else if (bIsEnum)
-		{
-			PackageInfo& Info = PackageInfos[CurrentPackageIdx];
-			Info.PackageIndex = CurrentPackageIdx;
+	}
 
-			Info.Enums.push_back(Obj.GetIndex());
-		}
+	/* All struct/class dependencies are known now, flatten them for the visits during PostInit and generation */
+	for (auto& [PackageIndex, Info] : PackageInfos)
+	{
+		Info.StructsSorted.BuildGraph();
+		Info.ClassesSorted.BuildGraph();
 	}
 }
 
@@ -413,7 +451,7 @@ void PackageManager::HelperInitEnumFwdDeclarationsForPackage(int32 PackageForFwd
 
 	std::vector<std::pair<int32, bool>>& EnumsToForwardDeclare = Info.EnumForwardDeclarations;
 
-	DependencyManager::OnVisitCallbackType CheckForEnumsToForwardDeclareCallback = [&EnumsToForwardDeclare, RequiredPackage, bIsClass](int32 Index) -> void
+	auto CheckForEnumsToForwardDeclareCallback = [&EnumsToForwardDeclare, RequiredPackage, bIsClass](int32 Index) -> void
 	{
 		HelperAddEnumsFromPacakageToFwdDeclarations(ObjectArray::GetByIndex<UEStruct>(Index), EnumsToForwardDeclare, RequiredPackage, bIsClass);
 	};
@@ -491,7 +529,7 @@ void PackageManager::HandleCycles()
 			/* Number of structs from PreviousPackage required by CurrentPackage */
 			int32 NumStructsRequiredByCurrent = 0x0;
 
-			DependencyManager::OnVisitCallbackType CountDependenciesForCurrent = [&NumStructsRequiredByCurrent, PreviousPackageIndex, bIsStruct](int32 Index) -> void
+			auto CountDependenciesForCurrent = [&NumStructsRequiredByCurrent, PreviousPackageIndex, bIsStruct](int32 Index) -> void
 			{
 				NumStructsRequiredByCurrent += HelperCountStructDependenciesOfPackage(ObjectArray::GetByIndex<UEStruct>(Index), PreviousPackageIndex, !bIsStruct);
 			};
@@ -501,7 +539,7 @@ void PackageManager::HandleCycles()
 			/* Number of structs from CurrentPackage required by CurrentPackage PreviousPackage */
 			int32 NumStructsRequiredByPrevious = 0x0;
 
-			DependencyManager::OnVisitCallbackType CountDependenciesForPrevious = [&NumStructsRequiredByPrevious, CurrentPackageIndex, bIsStruct](int32 Index) -> void
+			auto CountDependenciesForPrevious = [&NumStructsRequiredByPrevious, CurrentPackageIndex, bIsStruct](int32 Index) -> void
 			{
 				NumStructsRequiredByPrevious += HelperCountStructDependenciesOfPackage(ObjectArray::GetByIndex<UEStruct>(Index), CurrentPackageIndex, !bIsStruct);
 			};
@@ -519,7 +557,7 @@ void PackageManager::HandleCycles()
 			HandledPackages.push_back({ PackageIndexWithLeastDependencies, PackageIndexToMarkCyclicWith, bIsStruct, !bIsStruct });
 
 
-			DependencyManager::OnVisitCallbackType SetCycleCallback = [PackageIndexWithLeastDependencies, PackageIndexToMarkCyclicWith, bIsStruct](int32 Index) -> void
+			auto SetCycleCallback = [PackageIndexWithLeastDependencies, PackageIndexToMarkCyclicWith, bIsStruct](int32 Index) -> void
 			{
 				HelperMarkStructDependenciesOfPackage(ObjectArray::GetByIndex<UEStruct>(Index), PackageIndexToMarkCyclicWith, PackageIndexWithLeastDependencies, !bIsStruct);
 			};
@@ -530,7 +568,7 @@ void PackageManager::HandleCycles()
 		{
 			HandledPackages.push_back({ PreviousPackageIndex, CurrentPackageIndex, bIsStruct, !bIsStruct });
 
-			DependencyManager::OnVisitCallbackType SetCycleCallback = [PreviousPackageIndex, CurrentPackageIndex, bIsStruct](int32 Index) -> void
+			auto SetCycleCallback = [PreviousPackageIndex, CurrentPackageIndex, bIsStruct](int32 Index) -> void
 			{
 				HelperMarkStructDependenciesOfPackage(ObjectArray::GetByIndex<UEStruct>(Index), PreviousPackageIndex, CurrentPackageIndex, !bIsStruct);
 			};
@@ -539,7 +577,11 @@ void PackageManager::HandleCycles()
 		}
 	};
 
-	FindCycle(CleanedUpOnCycleFoundCallback);
+	IteratePackagesCallbackType CallbackForEachPackage = [](const PackageManagerIterationParams& OldParams, const PackageManagerIterationParams& NewParams, bool bIsStruct) -> void { };
+
+	/* A single walk over the package-graph reports the dependencies closing every cycle, and all cyclic components, at once */
+	CyclicComponents.clear();
+	IteratePackageGraph(CreatePackageGraph(), CallbackForEachPackage, CleanedUpOnCycleFoundCallback, CyclicComponents);
 
 
 	/* Actually remove the cycle form our dependency-graph. Couldn't be done before as it would've invalidated the iterator */
@@ -596,149 +638,216 @@ void PackageManager::PostInit()
 	HandleCycles();
 }
 
-void PackageManager::IterateSingleDependencyImplementation(SingleDependencyIterationParamsInternal& Params, bool bCheckForCycle)
+PackageManager::PackageGraph PackageManager::CreatePackageGraph()
 {
-	if (!Params.bShouldHandlePackage)
-		return;
+	PackageGraph Graph;
+	Graph.PackageIndices.reserve(PackageInfos.size());
 
-	const bool bIsIncluded = Params.IterationHitCounterRef >= CurrentIterationHitCount;
+	/* PackageIndex -> index of the structs-node of the package, the classes-node follows directly after it */
+	std::unordered_map<int32, int32> StructsNodeIndices;
+	StructsNodeIndices.reserve(PackageInfos.size());
 
-	if (!bIsIncluded)
+	for (const auto& [PackageIndex, Info] : PackageInfos)
 	{
-		Params.IterationHitCounterRef = CurrentIterationHitCount;
+		StructsNodeIndices[PackageIndex] = static_cast<int32>(Graph.PackageIndices.size() * 2);
+		Graph.PackageIndices.push_back(PackageIndex);
+	}
 
-		IncludeData& Include = Params.VisitedNodes[Params.CurrentIndex];
-		Include.bIncludedStructs = (Include.bIncludedStructs || Params.bIsStruct);
-		Include.bIncludedClasses = (Include.bIncludedClasses || !Params.bIsStruct);
+	Graph.EdgeOffsets.reserve((Graph.PackageIndices.size() * 2) + 1);
+	Graph.EdgeOffsets.push_back(0x0);
 
-		for (auto& [Index, Requirements] : Params.Dependencies)
+	auto AddEdgesForDependencies = [&Graph, &StructsNodeIndices](const DependencyListType& Dependencies) -> void
+	{
+		for (const auto& [Index, Requirements] : Dependencies)
 		{
-			Params.NewParams.bWasPrevNodeStructs = Params.bIsStruct;
-			Params.NewParams.bRequiresClasses = Requirements.bShouldIncludeClasses;
-			Params.NewParams.bRequiresStructs = Requirements.bShouldIncludeStructs;
-			Params.NewParams.RequiredPackage = Requirements.PackageIdx;
+			auto It = StructsNodeIndices.find(Requirements.PackageIdx);
 
-			/* Iterate dependencies recursively */
-			IterateDependenciesImplementation(Params.NewParams, Params.CallbackForEachPackage, Params.OnFoundCycle, bCheckForCycle);
-		}
+			if (It == StructsNodeIndices.end())
+				continue;
 
-		Params.VisitedNodes.erase(Params.CurrentIndex);
+			if (Requirements.bShouldIncludeStructs)
+				Graph.Edges.push_back(It->second);
 
-		// PERFORM ACTION
-		Params.CallbackForEachPackage(Params.NewParams, Params.OldParams, Params.bIsStruct);
-		return;
-	}
+			if (Requirements.bShouldIncludeClasses)
+				Graph.Edges.push_back(It->second + 1);
+		}
 
-	if (bCheckForCycle)
+		Graph.EdgeOffsets.push_back(static_cast<int32>(Graph.Edges.size()));
+	};
+
+	for (const int32 PackageIndex : Graph.PackageIndices)
 	{
-		auto It = Params.VisitedNodes.find(Params.CurrentIndex);
-		if (It != Params.VisitedNodes.end())
-		{
-			if ((It->second.bIncludedStructs && Params.bIsStruct) || (It->second.bIncludedClasses && !Params.bIsStruct))
-				Params.OnFoundCycle(Params.NewParams, Params.OldParams, Params.bIsStruct);
-		}
+		const DependencyInfo& Dependencies = PackageInfos.at(PackageIndex).PackageDependencies;
+
+		AddEdgesForDependencies(Dependencies.StructsDependencies);
+		AddEdgesForDependencies(Dependencies.ClassesDependencies);
 	}
+
+	return Graph;
 }
 
-void PackageManager::IterateDependenciesImplementation(const PackageManagerIterationParams& Params, const IteratePackagesCallbackType& CallbackForEachPackage, const FindCycleCallbackType& OnFoundCycle, bool bCheckForCycle)
+void PackageManager::IteratePackageGraph(const PackageGraph& Graph, const IteratePackagesCallbackType& CallbackForEachPackage, const FindCycleCallbackType& OnFoundCycle, std::vector<PackageCycleType>& OutCycles)
 {
-	PackageManagerIterationParams NewParams = {
-		.PrevPackage = Params.RequiredPackage,
+	struct StackFrame
+	{
+		int32 Node;
+		int32 NextEdge;
 
-		.VisitedNodes = Params.VisitedNodes,
+		PackageManagerIterationParams Params;
 	};
 
-	DependencyInfo& Dependencies = PackageInfos.at(Params.RequiredPackage).PackageDependencies;
+	constexpr uint8 StructsOnPathFlag = 0x1;
+	constexpr uint8 ClassesOnPathFlag = 0x2;
 
-	SingleDependencyIterationParamsInternal StructsParams{
-		.CallbackForEachPackage = CallbackForEachPackage,
-		.OnFoundCycle = OnFoundCycle,
+	const int32 NumNodes = static_cast<int32>(Graph.PackageIndices.size() * 2);
 
-		.NewParams = NewParams,
-		.OldParams = Params,
-		.Dependencies = Dependencies.StructsDependencies,
-		.VisitedNodes = Params.VisitedNodes,
+	/* Order in which the nodes were discovered, and the lowest discovery-index reachable from a node. -1 for nodes that weren't discovered yet. */
+	std::vector<int32> DiscoveryIndices(NumNodes, -1);
+	std::vector<int32> LowLinks(NumNodes, -1);
 
-		.CurrentIndex = Params.RequiredPackage,
-		.PrevIndex = Params.PrevPackage,
-		.IterationHitCounterRef = Dependencies.StructsIterationHitCount,
+	/* Nodes of components which weren't completed yet */
+	std::vector<int32> ComponentStack;
+	std::vector<bool> IsOnComponentStack(NumNodes, false);
 
-		.bShouldHandlePackage = Params.bRequiresStructs,
-		.bIsStruct = true,
-	};
+	/*
+	* Nodes of each package entered on the path from the current root, indexed by Node / 2. A package leaves the path as a whole once one
+	* of its nodes is finished. This reports the same cycles as the previous recursive walk, which HandleCycles relies on to break cycles.
+	*/
+	std::vector<uint8> PackagePathFlags(Graph.PackageIndices.size(), 0x0);
 
-	SingleDependencyIterationParamsInternal ClassesParams{
-		.CallbackForEachPackage = CallbackForEachPackage,
-		.OnFoundCycle = OnFoundCycle,
+	std::vector<StackFrame> CallStack;
 
-		.NewParams = NewParams,
-		.OldParams = Params,
-		.Dependencies = Dependencies.ClassesDependencies,
-		.VisitedNodes = Params.VisitedNodes,
+	int32 NextDiscoveryIndex = 0x0;
 
-		.CurrentIndex = Params.RequiredPackage,
-		.PrevIndex = Params.PrevPackage,
-		.IterationHitCounterRef = Dependencies.ClassesIterationHitCount,
+	auto GetPackage = [&Graph](int32 Node) -> int32 { return Graph.PackageIndices[Node / 2]; };
+	auto IsStructsNode = [](int32 Node) -> bool { return (Node % 2) == 0; };
+	auto GetPathFlag = [&](int32 Node) -> uint8 { return IsStructsNode(Node) ? StructsOnPathFlag : ClassesOnPathFlag; };
 
-		.bShouldHandlePackage = Params.bRequiresClasses,
-		.bIsStruct = false,
+	auto MakeParams = [&](int32 PrevNode, int32 Node) -> PackageManagerIterationParams
+	{
+		return {
+			.PrevPackage = PrevNode != -1 ? GetPackage(PrevNode) : -1,
+			.RequiredPackage = GetPackage(Node),
+
+			.bWasPrevNodeStructs = PrevNode != -1 ? IsStructsNode(PrevNode) : true,
+			.bRequiresClasses = !IsStructsNode(Node),
+			.bRequiresStructs = IsStructsNode(Node),
+		};
 	};
 
-	IterateSingleDependencyImplementation(StructsParams, bCheckForCycle);
-	IterateSingleDependencyImplementation(ClassesParams, bCheckForCycle);
-}
+	auto VisitNode = [&](int32 Node, const PackageManagerIterationParams& Params) -> void
+	{
+		DiscoveryIndices[Node] = NextDiscoveryIndex;
+		LowLinks[Node] = NextDiscoveryIndex;
+		NextDiscoveryIndex++;
 
-void PackageManager::IterateDependencies(const IteratePackagesCallbackType& CallbackForEachPackage)
-{
-	VisitedNodeContainerType VisitedNodes;
+		ComponentStack.push_back(Node);
+		IsOnComponentStack[Node] = true;
 
-	PackageManagerIterationParams Params = {
-		.PrevPackage = -1,
+		PackagePathFlags[Node / 2] |= GetPathFlag(Node);
 
-		.VisitedNodes = VisitedNodes,
+		CallStack.push_back({ Node, Graph.EdgeOffsets[Node], Params });
 	};
 
-	FindCycleCallbackType OnCycleFoundCallback = [](const PackageManagerIterationParams& OldParams, const PackageManagerIterationParams& NewParams, bool bIsStruct) -> void { };
+	for (int32 Root = 0; Root < NumNodes; Root++)
+	{
+		if (DiscoveryIndices[Root] != -1)
+			continue;
 
-	/* Increment hit counter for new iteration-cycle */
-	CurrentIterationHitCount++;
+		VisitNode(Root, MakeParams(-1, Root));
 
-	for (const auto& [PackageIndex, Info] : PackageInfos)
-	{
-		Params.RequiredPackage = PackageIndex;
-		Params.bWasPrevNodeStructs = true;
-		Params.bRequiresClasses = true;
-		Params.bRequiresStructs = true;
-		Params.VisitedNodes.clear();
+		while (!CallStack.empty())
+		{
+			StackFrame& Frame = CallStack.back();
+			const int32 Node = Frame.Node;
+
+			if (Frame.NextEdge < Graph.EdgeOffsets[Node + 1])
+			{
+				const int32 Dependency = Graph.Edges[Frame.NextEdge++];
+
+				/* Invalidates 'Frame' */
+				if (DiscoveryIndices[Dependency] == -1)
+				{
+					VisitNode(Dependency, MakeParams(Node, Dependency));
+					continue;
+				}
+
+				if (IsOnComponentStack[Dependency] && DiscoveryIndices[Dependency] < LowLinks[Node])
+					LowLinks[Node] = DiscoveryIndices[Dependency];
 
-		IterateDependenciesImplementation(Params, CallbackForEachPackage, OnCycleFoundCallback, false);
+				if (PackagePathFlags[Dependency / 2] & GetPathFlag(Dependency))
+					OnFoundCycle(Frame.Params, MakeParams(Node, Dependency), IsStructsNode(Dependency));
+
+				continue;
+			}
+
+			/* All dependencies of this node were handled */
+			const PackageManagerIterationParams Params = Frame.Params;
+
+			CallStack.pop_back();
+			PackagePathFlags[Node / 2] = 0x0;
+
+			CallbackForEachPackage(!CallStack.empty() ? CallStack.back().Params : Params, Params, IsStructsNode(Node));
+
+			if (!CallStack.empty())
+			{
+				int32& ParentLowLink = LowLinks[CallStack.back().Node];
+
+				if (LowLinks[Node] < ParentLowLink)
+					ParentLowLink = LowLinks[Node];
+			}
+
+			if (LowLinks[Node] != DiscoveryIndices[Node])
+				continue;
+
+			/* This node is the first node discovered in its component, the component consists of all nodes above it on the ComponentStack */
+			const auto ComponentStart = std::find(ComponentStack.rbegin(), ComponentStack.rend(), Node).base() - 1;
+
+			const auto EdgesBegin = Graph.Edges.begin() + Graph.EdgeOffsets[Node];
+			const auto EdgesEnd = Graph.Edges.begin() + Graph.EdgeOffsets[Node + 1];
+
+			const bool bRequiresItself = std::find(EdgesBegin, EdgesEnd, Node) != EdgesEnd;
+
+			if ((ComponentStack.end() - ComponentStart) > 1 || bRequiresItself)
+			{
+				PackageCycleType& Cycle = OutCycles.emplace_back();
+				Cycle.reserve(ComponentStack.end() - ComponentStart);
+
+				for (auto It = ComponentStart; It != ComponentStack.end(); ++It)
+					Cycle.push_back({ GetPackage(*It), IsStructsNode(*It) });
+			}
+
+			for (auto It = ComponentStart; It != ComponentStack.end(); ++It)
+				IsOnComponentStack[*It] = false;
+
+			ComponentStack.erase(ComponentStart, ComponentStack.end());
+		}
 	}
 }
 
-void PackageManager::FindCycle(const FindCycleCallbackType& OnFoundCycle)
+void PackageManager::IterateDependencies(const IteratePackagesCallbackType& CallbackForEachPackage)
 {
-	VisitedNodeContainerType VisitedNodes;
+	FindCycleCallbackType OnCycleFoundCallback = [](const PackageManagerIterationParams& OldParams, const PackageManagerIterationParams& NewParams, bool bIsStruct) -> void { };
 
-	PackageManagerIterationParams Params = {
-		.PrevPackage = -1,
+	std::vector<PackageCycleType> Cycles;
+	IteratePackageGraph(CreatePackageGraph(), CallbackForEachPackage, OnCycleFoundCallback, Cycles);
+}
 
-		.VisitedNodes = VisitedNodes,
-	};
+void PackageManager::FindCycle(const FindCycleCallbackType& OnFoundCycle)
+{
+	IteratePackagesCallbackType CallbackForEachPackage = [](const PackageManagerIterationParams& OldParams, const PackageManagerIterationParams& NewParams, bool bIsStruct) -> void { };
 
-	FindCycleCallbackType CallbackForEachPackage = [](const PackageManagerIterationParams& OldParams, const PackageManagerIterationParams& NewParams, bool bIsStruct) -> void {};
+	std::vector<PackageCycleType> Cycles;
+	IteratePackageGraph(CreatePackageGraph(), CallbackForEachPackage, OnFoundCycle, Cycles);
+}
 
-	/* Increment hit counter for new iteration-cycle */
-	CurrentIterationHitCount++;
+std::vector<PackageCycleType> PackageManager::FindStronglyConnectedComponents()
+{
+	IteratePackagesCallbackType CallbackForEachPackage = [](const PackageManagerIterationParams& OldParams, const PackageManagerIterationParams& NewParams, bool bIsStruct) -> void { };
+	FindCycleCallbackType OnCycleFoundCallback = [](const PackageManagerIterationParams& OldParams, const PackageManagerIterationParams& NewParams, bool bIsStruct) -> void { };
 
-	for (const auto& [PackageIndex, Info] : PackageInfos)
-	{
-		Params.RequiredPackage = PackageIndex;
-		Params.bWasPrevNodeStructs = true;
-		Params.bRequiresClasses = true;
-		Params.bRequiresStructs = true;
-		Params.VisitedNodes.clear();
+	std::vector<PackageCycleType> Cycles;
+	IteratePackageGraph(CreatePackageGraph(), CallbackForEachPackage, OnCycleFoundCallback, Cycles);
 
-		IterateDependenciesImplementation(Params, CallbackForEachPackage, OnFoundCycle, true);
-	}
+	return Cycles;
 }
-
@@ -5,6 +5,7 @@
 #include "UnrealObjects.h"
 #include "DependencyManager.h"
 #include "HashStringTable.h"
+#include "IndexedInfoMap.h"
 
 
 namespace PackageManagerUtils
@@ -22,22 +23,11 @@ struct RequirementInfo
 	bool bShouldIncludeClasses;
 };
 
-struct VisitedNodeInformation
-{
-	int32 PackageIdx;
-	mutable uint64 StructsIterationHitCount = 0x0;
-	mutable uint64 ClassesIterationHitCount = 0x0;
-};
-
 using DependencyListType = std::unordered_map<int32, RequirementInfo>;
 
 
 struct DependencyInfo
 {
-	/* Counter incremented every time this element is hit during iteration, **if** the counter is less than the CurrentIterationIndex */
-	mutable uint64 StructsIterationHitCount = 0x0;
-	mutable uint64 ClassesIterationHitCount = 0x0;
-
 	/* List of packages required by "ThisPackage_structs.h" */
 	DependencyListType StructsDependencies;
 
@@ -48,13 +38,17 @@ struct DependencyInfo
 	DependencyListType ParametersDependencies;
 };
 
-struct IncludeData
+/* Node of the package-graph, every package has one node for "ThisPackage_structs.h" and one for "ThisPackage_classes.h" */
+struct PackageGraphNode
 {
-	bool bIncludedStructs = false;
-	bool bIncludedClasses = false;
+	int32 PackageIdx;
+	bool bIsStruct;
+
+	inline bool operator==(const PackageGraphNode& Other) const = default;
 };
 
-using VisitedNodeContainerType = std::unordered_map<int32, IncludeData>;
+/* Strongly connected component of the package-graph, containing either more than one node or a single node requiring itself */
+using PackageCycleType = std::vector<PackageGraphNode>;
 
 
 struct PackageInfo
@@ -131,7 +125,7 @@ public:
 	void ErasePackageDependencyFromClasses(int32 Package) const;
 };
 
-using PackageManagerOverrideMapType = std::unordered_map<int32 /* PackageIndex */, PackageInfo>;
+using PackageManagerOverrideMapType = IndexedInfoMap<PackageInfo>;
 
 struct PackageInfoIterator
 {
@@ -144,17 +138,16 @@ private:
 
 private:
 	const MapType& PackageInfos;
-	uint8 CurrentIterationHitCount;
 	IteratorType It;
 
 private:
-	explicit PackageInfoIterator(const MapType& Infos, uint8 IterationHitCount, IteratorType ItPos)
-		: PackageInfos(Infos), CurrentIterationHitCount(IterationHitCount), It(ItPos)
+	explicit PackageInfoIterator(const MapType& Infos, IteratorType ItPos)
+		: PackageInfos(Infos), It(ItPos)
 	{
 	}
 
-	explicit PackageInfoIterator(const MapType& Infos, uint8 IterationHitCount)
-		: PackageInfos(Infos), CurrentIterationHitCount(IterationHitCount), It(Infos.cbegin())
+	explicit PackageInfoIterator(const MapType& Infos)
+		: PackageInfos(Infos), It(Infos.cbegin())
 	{
 	}
 
@@ -166,8 +159,8 @@ public:
 	inline bool operator!=(const PackageInfoIterator& Other) const { return It != Other.It; }
 
 public:
-	PackageInfoIterator begin() const { return PackageInfoIterator(PackageInfos, CurrentIterationHitCount, PackageInfos.cbegin()); }
-	PackageInfoIterator end() const   { return PackageInfoIterator(PackageInfos, CurrentIterationHitCount, PackageInfos.cend());   }
+	PackageInfoIterator begin() const { return PackageInfoIterator(PackageInfos, PackageInfos.cbegin()); }
+	PackageInfoIterator end() const   { return PackageInfoIterator(PackageInfos, PackageInfos.cend());   }
 };
 
 struct PackageManagerIterationParams
@@ -178,8 +171,6 @@ struct PackageManagerIterationParams
 	bool bWasPrevNodeStructs;
 	bool bRequiresClasses;
 	bool bRequiresStructs;
-
-	VisitedNodeContainerType& VisitedNodes;
 };
 
 class PackageManager
@@ -195,33 +186,26 @@ public:
 	using FindCycleCallbackType = std::function<void(const PackageManagerIterationParams& OldParams, const PackageManagerIterationParams& NewParams, bool bIsStruct)>;
 
 private:
-	struct SingleDependencyIterationParamsInternal
+	/*
+	* Flat graph over all nodes of the package-graph. Node '2 * i' is the structs-node and node '2 * i + 1' the classes-node of PackageIndices[i].
+	* The dependencies of node 'n' are Edges[EdgeOffsets[n]] to Edges[EdgeOffsets[n + 1] - 1].
+	*/
+	struct PackageGraph
 	{
-		const IteratePackagesCallbackType& CallbackForEachPackage;
-		const FindCycleCallbackType& OnFoundCycle;
-
-		PackageManagerIterationParams& NewParams;
-		const PackageManagerIterationParams& OldParams;
-		const DependencyListType& Dependencies;
-		VisitedNodeContainerType& VisitedNodes;
-
-		int32 CurrentIndex;
-		int32 PrevIndex;
-		uint64& IterationHitCounterRef;
-
-		bool bShouldHandlePackage;
-		bool bIsStruct;
+		std::vector<int32> PackageIndices;
+		std::vector<int32> EdgeOffsets;
+		std::vector<int32> Edges;
 	};
 
 private:
 	/* NameTable containing names of all Packages as well as information on name-collisions */
 	static inline HashStringTable UniquePackageNameTable;
 
-	/* Map containing infos on all Packages. Implemented due to information missing in the Unreal's reflection system (PackageSize). */
+	/* Infos on all Packages, indexed by the packages' GObjects-index. Implemented due to information missing in the Unreal's reflection system (PackageSize). */
 	static inline OverrideMaptType PackageInfos;
 
-	/* Count to track how often the PackageInfos was iterated. Allows for up to 2^64 iterations of this list. */
-	static inline uint64 CurrentIterationHitCount = 0x0;
+	/* Cyclic components of the package-graph found in PostInit(), before the cycles were broken */
+	static inline std::vector<PackageCycleType> CyclicComponents;
 
 	static inline bool bIsInitialized = false;
 	static inline bool bIsPostInitialized = false;
@@ -250,20 +234,32 @@ private:
 	}
 
 private:
-	static void IterateSingleDependencyImplementation(SingleDependencyIterationParamsInternal& Params, bool bCheckForCycle);
+	static PackageGraph CreatePackageGraph();
 
-	static void IterateDependenciesImplementation(const PackageManagerIterationParams& Params, const IteratePackagesCallbackType& CallbackForEachPackage, const FindCycleCallbackType& OnFoundCycle, bool bCheckForCycle);
+	/*
+	* Single iterative depth-first walk over the graph (Tarjan), calls CallbackForEachPackage for every node after all of its dependencies,
+	* OnFoundCycle for every dependency on a package whose node is on the current path and adds every cyclic component to OutCycles.
+	*/
+	static void IteratePackageGraph(const PackageGraph& Graph, const IteratePackagesCallbackType& CallbackForEachPackage, const FindCycleCallbackType& OnFoundCycle, std::vector<PackageCycleType>& OutCycles);
 
 public:
 	static void IterateDependencies(const IteratePackagesCallbackType& CallbackForEachPackage);
 	static void FindCycle(const FindCycleCallbackType& OnFoundCycle);
 
+	/* Returns all cyclic components of the current package-graph, GetCyclicComponents() returns the ones found before PostInit() broke the cycles */
+	static std::vector<PackageCycleType> FindStronglyConnectedComponents();
+
 public:
 	static inline const OverrideMaptType& GetPackageInfos()
 	{
 		return PackageInfos;
 	}
 
+	static inline const std::vector<PackageCycleType>& GetCyclicComponents()
+	{
+		return CyclicComponents;
+	}
+
 	static inline std::string GetName(int32 PackageIndex)
 	{
 		 return GetInfo(PackageIndex).GetName();
@@ -287,10 +283,9 @@ public:
 		return PackageInfos.at(Package.GetIndex());
 	}
 
+	/* Doesn't modify any state, safe to call from all generator threads running concurrently in Generator::GenerateAll() */
 	static inline PackageInfoIterator IterateOverPackageInfos()
 	{
-		CurrentIterationHitCount++;
-
-		return PackageInfoIterator(PackageInfos, CurrentIterationHitCount);
+		return PackageInfoIterator(PackageInfos);
 	}
 };
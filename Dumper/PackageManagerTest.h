@@ -19,6 +19,7 @@ public:
 		TestMutliIterations<bDoDebugPrinting>();
 		TestFindCyclidDependencies<bDoDebugPrinting>();
 		TestCyclicDependencyDetection<bDoDebugPrinting>();
+		TestStronglyConnectedComponents<bDoDebugPrinting>();
 		TestUniquePackageNameGeneration<bDoDebugPrinting>();
 		PrintDbgMessage<bDoDebugPrinting>("");
 	}
@@ -63,8 +64,6 @@ public:
 	InfoHandle.GetSortedClasses().GetNumEntries(), \
 	InfoHandle.GetFunctions().size(), \
 	InfoHandle.GetEnums().size(), \
-	InfoHandle.GetPackageDependencies().StructsIterationHitCount, \
-	InfoHandle.GetPackageDependencies().ClassesIterationHitCount, \
 	InfoHandle.GetPackageDependencies().StructsDependencies.size(), \
 	InfoHandle.GetPackageDependencies().ClassesDependencies.size(), \
 	InfoHandle.GetPackageDependencies().ParametersDependencies.size() \
@@ -82,8 +81,6 @@ public:
 	Functions.size() = 0x{:X},
 	Enums.size() = 0x{:X},
 	{{
-		StructsIterationHitCount = {},
-		ClassesIterationHitCount = {},
 		StructsDependencies.size() = 0x{:X},
 		ClassesDependencies.size() = 0x{:X},
 		ParametersDependencies.size() = 0x{:X},
@@ -142,8 +139,6 @@ public:
 
 		PackageManager::Init();
 
-		VisitedNodeContainerType Visited;
-
 		std::vector<int32> Indices;
 		std::vector<int32> SecondIndices;
 		Indices.reserve(PackageManager::PackageInfos.size());
@@ -194,51 +189,88 @@ public:
 	template<bool bDoDebugPrinting = false>
 	static inline void TestCyclicDependencyDetection()
 	{
-		//bool bSuccededTestWithoutError = false;
-		//
-		//PackageManager::Init();
-		//
-		//VisitedNodeContainerType Visited;
-		//PackageManager::OverrideMaptType CyclicGraph;
-		//
-		//
-		///*
-        //                                          
-        //           +--------------+               
-        //           | CYCLIC GRAPH |               
-        //           +--------------+               
-        //                                          
-        //                  +------------------+    
-        //                  |                  |    
-        //            +-----+-----+            |    
-        //            | 0_structs |            |    
-        //            +-----+-----+   CYCLE    |    
-        //                  |                  |    
-        //         +--------+--------+         |    
-        //         |                 |         |    
-        //   +-----+-----+     +-----+-----+   |    
-        //   | 1_classes |     | 1_structs |---+    
-        //   +-----------+     +-----------+        
-        //                                          
-		//*/
-		//
-		///* Setup cyclic graph as above */
-		//CyclicGraph[0].PackageDependencies.StructsDependencies[1] = { .PackageIdx = 1, .bShouldInclude = {.Structs = true, .Classes = false} };
-		//CyclicGraph[1].PackageDependencies.StructsDependencies[0] = { .PackageIdx = 0, .bShouldInclude = {.Structs = true, .Classes = false} };
-		//CyclicGraph[1].PackageDependencies.ClassesDependencies[0] = { .PackageIdx = 0, .bShouldInclude = {.Structs = true, .Classes = false} };
-		//
-		//for (auto& [FakePackageIndex, Info] : CyclicGraph)
-		//{
-		//	Visited.clear();
-		//	Params.Requriements = { FakePackageIndex, { true, true } };
-		//
-		//	const bool bFoundCycle = false; // FindCycle(Params, !bDoDebugPrinting, false);
-		//
-		//	if (bFoundCycle)
-		//		bSuccededTestWithoutError = true;
-		//}
-		//
-		//std::cout << __FUNCTION__ << ": " << (bSuccededTestWithoutError ? "SUCCEEDED!" : "FAILED!") << std::endl;
+		bool bSuccededTestWithoutError = true;
+
+		/*
+		* Fake packages 10, 20 and 30. Node '2 * i' is the structs-node, node '2 * i + 1' the classes-node of PackageIndices[i].
+		* 
+		*   10_structs -> 20_classes -> 10_classes -> 10_structs   (cycle, 10_structs is on the path)
+		*   10_structs -> 30_classes -> 10_structs                 (not reported, package 10 left the path when 10_classes finished)
+		* 
+		* All four nodes on those paths are part of the same cyclic component.
+		*/
+		PackageManager::PackageGraph CyclicGraph;
+		CyclicGraph.PackageIndices = { 10, 20, 30 };
+		CyclicGraph.EdgeOffsets = { 0, 2, 3, 3, 4, 4, 5 };
+		CyclicGraph.Edges = { 3, 5, 0, 1, 0 };
+
+		std::vector<std::pair<int32, bool>> VisitedNodes;
+		std::vector<std::pair<int32, int32>> FoundCycles;
+
+		PackageManager::IteratePackagesCallbackType OnPackageVisit = [&](const PackageManagerIterationParams& OldParams, const PackageManagerIterationParams& NewParams, bool bIsStruct) -> void
+		{
+			VisitedNodes.emplace_back(NewParams.RequiredPackage, bIsStruct);
+		};
+
+		PackageManager::FindCycleCallbackType OnCycleFound = [&](const PackageManagerIterationParams& OldParams, const PackageManagerIterationParams& NewParams, bool bIsStruct) -> void
+		{
+			PrintDbgMessage<bDoDebugPrinting>("Cycle between: Current - '{}{}' and Previous - '{}{}'", NewParams.RequiredPackage, (bIsStruct ? "_structs" : "_classes"), NewParams.PrevPackage, (NewParams.bWasPrevNodeStructs ? "_structs" : "_classes"));
+
+			SetBoolIfFailed(bSuccededTestWithoutError, bIsStruct && !NewParams.bWasPrevNodeStructs);
+			FoundCycles.emplace_back(NewParams.PrevPackage, NewParams.RequiredPackage);
+		};
+
+		std::vector<PackageCycleType> Components;
+		PackageManager::IteratePackageGraph(CyclicGraph, OnPackageVisit, OnCycleFound, Components);
+
+		/* Every node is visited after all of its dependencies */
+		const std::vector<std::pair<int32, bool>> ExpectedOrder = { { 10, false }, { 20, false }, { 30, false }, { 10, true }, { 20, true }, { 30, true } };
+		const std::vector<std::pair<int32, int32>> ExpectedCycles = { { 10, 10 } };
+		const std::vector<PackageCycleType> ExpectedComponents = { { { 10, true }, { 20, false }, { 10, false }, { 30, false } } };
+
+		SetBoolIfFailed(bSuccededTestWithoutError, VisitedNodes == ExpectedOrder);
+		SetBoolIfFailed(bSuccededTestWithoutError, FoundCycles == ExpectedCycles);
+		SetBoolIfFailed(bSuccededTestWithoutError, Components == ExpectedComponents);
+
+		std::cout << __FUNCTION__ << ": " << (bSuccededTestWithoutError ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
+	template<bool bDoDebugPrinting = false>
+	static inline void TestStronglyConnectedComponents()
+	{
+		bool bSuccededTestWithoutError = true;
+
+		/*
+		* Fake packages 40, 50 and 60, laid out like in TestCyclicDependencyDetection.
+		* 
+		*   40_structs <-> 50_structs   (cyclic component of two nodes)
+		*   40_classes  -> 40_structs   (requires a cyclic component, but isn't part of it)
+		*   60_classes  -> 60_classes   (a single node requiring itself is cyclic too)
+		*/
+		PackageManager::PackageGraph CyclicGraph;
+		CyclicGraph.PackageIndices = { 40, 50, 60 };
+		CyclicGraph.EdgeOffsets = { 0, 1, 2, 3, 3, 3, 4 };
+		CyclicGraph.Edges = { 2, 0, 0, 5 };
+
+		PackageManager::IteratePackagesCallbackType OnPackageVisit = [](const PackageManagerIterationParams& OldParams, const PackageManagerIterationParams& NewParams, bool bIsStruct) -> void { };
+		PackageManager::FindCycleCallbackType OnCycleFound = [](const PackageManagerIterationParams& OldParams, const PackageManagerIterationParams& NewParams, bool bIsStruct) -> void { };
+
+		std::vector<PackageCycleType> Components;
+		PackageManager::IteratePackageGraph(CyclicGraph, OnPackageVisit, OnCycleFound, Components);
+
+		for (const PackageCycleType& Component : Components)
+		{
+			for (const PackageGraphNode& Node : Component)
+				PrintDbgMessage<bDoDebugPrinting>("Component node: '{}{}'", Node.PackageIdx, (Node.bIsStruct ? "_structs" : "_classes"));
+
+			PrintDbgMessage<bDoDebugPrinting>("");
+		}
+
+		const std::vector<PackageCycleType> ExpectedComponents = { { { 40, true }, { 50, true } }, { { 60, false } } };
+
+		SetBoolIfFailed(bSuccededTestWithoutError, Components == ExpectedComponents);
+
+		std::cout << __FUNCTION__ << ": " << (bSuccededTestWithoutError ? "SUCCEEDED!" : "FAILED!") << std::endl;
 	}
 
 	template<bool bDoDebugPrinting = false>
@@ -0,0 +1,455 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <bit>
+#include <vector>
+#include <functional>
+
+#include <emmintrin.h>
+#include <immintrin.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/*
+* Vectorized signature-scanning. Doesn't depend on Windows, so it can be tested and benchmarked on any x64 platform (see PatternScannerTest.h).
+*
+* Candidates are found by comparing the first and the last fixed (non-wildcard) byte of a pattern for 16 (SSE2) or 32 (AVX2) positions at once.
+* Only positions where both of these bytes match are compared completely.
+*/
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#define PATTERNSCANNER_AVX2_TARGET
+#else
+#define PATTERNSCANNER_AVX2_TARGET __attribute__((target("avx2")))
+#endif
+
+
+/* A signature like "48 8D 0D ? ? ? ? E8", parsed once. Wildcards are '?' or '??'. */
+class BytePattern
+{
+private:
+	std::vector<uint8_t> Bytes;
+
+	/* Bits of each byte which need to match. 0xFF for regular bytes, 0x00 for wildcards. */
+	std::vector<uint8_t> Masks;
+
+	/* First and last byte which isn't a wildcard, -1 if the pattern only consists of wildcards */
+	int32_t FirstFixedIdx = -1;
+	int32_t LastFixedIdx = -1;
+
+	/* Cleared for signatures containing values which don't fit into a byte or characters which aren't hex digits, these never match any memory */
+	bool bCanMatch = true;
+
+public:
+	BytePattern() = default;
+
+	inline BytePattern(const char* Signature)
+	{
+		const char* const End = Signature + strlen(Signature);
+
+		for (const char* Current = Signature; Current < End; ++Current)
+		{
+			if (*Current == ' ')
+				continue;
+
+			if (*Current == '?')
+			{
+				if (Current[1] == '?')
+					++Current;
+
+				Bytes.push_back(0x0);
+				Masks.push_back(0x0);
+				continue;
+			}
+
+			char* ByteEnd = nullptr;
+			const unsigned long Value = strtoul(Current, &ByteEnd, 16);
+
+			/* Nothing was parsed, eg. "48 ZZ" or "48,8D", the rest of the signature can't be trusted */
+			if (ByteEnd == Current)
+			{
+				bCanMatch = false;
+				break;
+			}
+
+			/* Missing spaces, eg. "E848", result in values which never matched a byte */
+			if (Value > 0xFF)
+				bCanMatch = false;
+
+			Bytes.push_back(static_cast<uint8_t>(Value));
+			Masks.push_back(0xFF);
+
+			Current = ByteEnd - 1;
+		}
+
+		UpdateFixedIndices();
+	}
+
+	/* Values of -1 are wildcards */
+	inline BytePattern(const std::vector<int>& Signature)
+	{
+		Bytes.reserve(Signature.size());
+		Masks.reserve(Signature.size());
+
+		for (const int Value : Signature)
+		{
+			if (Value != -1 && (Value < 0x0 || Value > 0xFF))
+				bCanMatch = false;
+
+			Bytes.push_back(Value == -1 ? 0x0 : static_cast<uint8_t>(Value));
+			Masks.push_back(Value == -1 ? 0x0 : 0xFF);
+		}
+
+		UpdateFixedIndices();
+	}
+
+	/* Pattern with partially fixed bytes, a byte matches if '(Memory & Mask) == Byte' */
+	inline BytePattern(std::vector<uint8_t>&& InBytes, std::vector<uint8_t>&& InMasks)
+		: Bytes(std::move(InBytes)), Masks(std::move(InMasks))
+	{
+		for (size_t i = 0; i < Bytes.size(); i++)
+			Bytes[i] &= Masks[i];
+
+		UpdateFixedIndices();
+	}
+
+private:
+	inline void UpdateFixedIndices()
+	{
+		for (int32_t i = 0; i < static_cast<int32_t>(Masks.size()); i++)
+		{
+			if (Masks[i] == 0x0)
+				continue;
+
+			if (FirstFixedIdx == -1)
+				FirstFixedIdx = i;
+
+			LastFixedIdx = i;
+		}
+	}
+
+public:
+	inline size_t Size() const { return Bytes.size(); }
+
+	inline bool CanMatch() const { return bCanMatch && !Bytes.empty(); }
+	inline bool HasFixedBytes() const { return FirstFixedIdx != -1; }
+
+	inline int32_t GetFirstFixedIdx() const { return FirstFixedIdx; }
+	inline int32_t GetLastFixedIdx() const { return LastFixedIdx; }
+
+	inline uint8_t GetByte(int32_t Index) const { return Bytes[Index]; }
+	inline uint8_t GetMask(int32_t Index) const { return Masks[Index]; }
+
+	inline bool MatchesAt(const uint8_t* Address) const
+	{
+		for (size_t i = 0; i < Bytes.size(); i++)
+		{
+			if ((Address[i] & Masks[i]) != Bytes[i])
+				return false;
+		}
+
+		return true;
+	}
+
+	inline bool operator==(const BytePattern& Other) const
+	{
+		return Bytes == Other.Bytes && Masks == Other.Masks && bCanMatch == Other.bCanMatch;
+	}
+};
+
+
+namespace PatternScanUtils
+{
+	inline bool IsAVX2Supported()
+	{
+		static const bool bIsSupported = []() -> bool
+		{
+#if defined(_MSC_VER)
+			int CpuInfo[4];
+
+			__cpuid(CpuInfo, 0x0);
+
+			if (CpuInfo[0] < 0x7)
+				return false;
+
+			__cpuid(CpuInfo, 0x1);
+
+			constexpr int OSXSAVEBit = 1 << 27;
+			constexpr int AVXBit = 1 << 28;
+
+			if ((CpuInfo[2] & OSXSAVEBit) == 0x0 || (CpuInfo[2] & AVXBit) == 0x0)
+				return false;
+
+			/* The OS needs to save the upper halves of the YMM registers on context switches */
+			if ((_xgetbv(0x0) & 0x6) != 0x6)
+				return false;
+
+			__cpuidex(CpuInfo, 0x7, 0x0);
+
+			constexpr int AVX2Bit = 1 << 5;
+
+			return (CpuInfo[1] & AVX2Bit) != 0x0;
+#else
+			return __builtin_cpu_supports("avx2");
+#endif
+		}();
+
+		return bIsSupported;
+	}
+
+	/* Calls 'OnMatch' for every position in [Start, Start + NumPositions) where the pattern matches, until 'OnMatch' returns true. Plain byte by byte comparison. */
+	template<typename OnMatchType>
+	inline bool ForEachMatchScalar(const BytePattern& Pattern, const uint8_t* Start, size_t NumPositions, OnMatchType&& OnMatch)
+	{
+		for (size_t i = 0; i < NumPositions; i++)
+		{
+			if (Pattern.MatchesAt(Start + i) && OnMatch(Start + i))
+				return true;
+		}
+
+		return false;
+	}
+
+	template<typename OnMatchType>
+	inline bool ForEachMatchSSE2(const BytePattern& Pattern, const uint8_t* Start, size_t NumPositions, OnMatchType&& OnMatch)
+	{
+		constexpr size_t VectorSize = sizeof(__m128i);
+
+		const int32_t FirstIdx = Pattern.GetFirstFixedIdx();
+		const int32_t LastIdx = Pattern.GetLastFixedIdx();
+
+		const __m128i FirstByte = _mm_set1_epi8(static_cast<char>(Pattern.GetByte(FirstIdx)));
+		const __m128i FirstMask = _mm_set1_epi8(static_cast<char>(Pattern.GetMask(FirstIdx)));
+		const __m128i LastByte = _mm_set1_epi8(static_cast<char>(Pattern.GetByte(LastIdx)));
+		const __m128i LastMask = _mm_set1_epi8(static_cast<char>(Pattern.GetMask(LastIdx)));
+
+		size_t i = 0;
+
+		for (; i + VectorSize <= NumPositions; i += VectorSize)
+		{
+			const __m128i FirstBlock = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Start + i + FirstIdx));
+			const __m128i LastBlock = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Start + i + LastIdx));
+
+			const __m128i FirstEqual = _mm_cmpeq_epi8(_mm_and_si128(FirstBlock, FirstMask), FirstByte);
+			const __m128i LastEqual = _mm_cmpeq_epi8(_mm_and_si128(LastBlock, LastMask), LastByte);
+
+			uint32_t Candidates = static_cast<uint32_t>(_mm_movemask_epi8(_mm_and_si128(FirstEqual, LastEqual)));
+
+			while (Candidates != 0x0)
+			{
+				const uint8_t* Candidate = Start + i + std::countr_zero(Candidates);
+
+				if (Pattern.MatchesAt(Candidate) && OnMatch(Candidate))
+					return true;
+
+				Candidates &= Candidates - 1;
+			}
+		}
+
+		return ForEachMatchScalar(Pattern, Start + i, NumPositions - i, OnMatch);
+	}
+
+	template<typename OnMatchType>
+	PATTERNSCANNER_AVX2_TARGET inline bool ForEachMatchAVX2(const BytePattern& Pattern, const uint8_t* Start, size_t NumPositions, OnMatchType&& OnMatch)
+	{
+		constexpr size_t VectorSize = sizeof(__m256i);
+
+		const int32_t FirstIdx = Pattern.GetFirstFixedIdx();
+		const int32_t LastIdx = Pattern.GetLastFixedIdx();
+
+		const __m256i FirstByte = _mm256_set1_epi8(static_cast<char>(Pattern.GetByte(FirstIdx)));
+		const __m256i FirstMask = _mm256_set1_epi8(static_cast<char>(Pattern.GetMask(FirstIdx)));
+		const __m256i LastByte = _mm256_set1_epi8(static_cast<char>(Pattern.GetByte(LastIdx)));
+		const __m256i LastMask = _mm256_set1_epi8(static_cast<char>(Pattern.GetMask(LastIdx)));
+
+		size_t i = 0;
+
+		for (; i + VectorSize <= NumPositions; i += VectorSize)
+		{
+			const __m256i FirstBlock = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Start + i + FirstIdx));
+			const __m256i LastBlock = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Start + i + LastIdx));
+
+			const __m256i FirstEqual = _mm256_cmpeq_epi8(_mm256_and_si256(FirstBlock, FirstMask), FirstByte);
+			const __m256i LastEqual = _mm256_cmpeq_epi8(_mm256_and_si256(LastBlock, LastMask), LastByte);
+
+			uint32_t Candidates = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(FirstEqual, LastEqual)));
+
+			while (Candidates != 0x0)
+			{
+				const uint8_t* Candidate = Start + i + std::countr_zero(Candidates);
+
+				if (Pattern.MatchesAt(Candidate) && OnMatch(Candidate))
+					return true;
+
+				Candidates &= Candidates - 1;
+			}
+		}
+
+		return ForEachMatchSSE2(Pattern, Start + i, NumPositions - i, OnMatch);
+	}
+
+	/*
+	* Calls 'OnMatch(const uint8_t* Match)' for every match of the pattern starting in [Start, Start + NumPositions), in ascending order, until 'OnMatch' returns true.
+	*
+	* Reads up to 'Start + NumPositions + Pattern.Size() - 1', returns true if 'OnMatch' returned true.
+	*/
+	template<typename OnMatchType>
+	inline bool ForEachMatch(const BytePattern& Pattern, const uint8_t* Start, size_t NumPositions, OnMatchType&& OnMatch)
+	{
+		if (!Pattern.CanMatch() || NumPositions == 0x0)
+			return false;
+
+		if (!Pattern.HasFixedBytes())
+			return ForEachMatchScalar(Pattern, Start, NumPositions, OnMatch);
+
+		if (IsAVX2Supported())
+			return ForEachMatchAVX2(Pattern, Start, NumPositions, OnMatch);
+
+		return ForEachMatchSSE2(Pattern, Start, NumPositions, OnMatch);
+	}
+
+	/* Returns the first match in [Start, Start + NumPositions) after skipping 'SkipCount' matches, or nullptr */
+	inline const uint8_t* FindFirst(const BytePattern& Pattern, const uint8_t* Start, size_t NumPositions, int32_t SkipCount = 0x0)
+	{
+		const uint8_t* Result = nullptr;
+
+		ForEachMatch(Pattern, Start, NumPositions, [&Result, &SkipCount](const uint8_t* Match) -> bool
+		{
+			if (SkipCount-- > 0x0)
+				return false;
+
+			Result = Match;
+			return true;
+		});
+
+		return Result;
+	}
+}
+
+
+/*
+* Finds the first match of many patterns while only reading the memory once.
+*
+* The range is scanned in chunks small enough to stay in the L1-cache, every pattern which wasn't found yet is matched against the chunk
+* before moving on to the next one. Patterns which are equal share their scan, each one can have a 'Verify' callback to reject matches.
+*/
+class MultiPatternScanner
+{
+public:
+	/* Called for every match of the pattern, returns true to accept the match */
+	using VerifyFuncType = std::function<bool(const uint8_t* Match)>;
+
+private:
+	static constexpr size_t ChunkSize = 0x4000;
+
+	struct PatternEntry
+	{
+		VerifyFuncType Verify;
+		const uint8_t* Result = nullptr;
+	};
+
+	struct PatternGroup
+	{
+		BytePattern Pattern;
+		std::vector<int32_t> EntryIndices;
+		int32_t NumUnresolved = 0x0;
+	};
+
+private:
+	std::vector<PatternEntry> Entries;
+	std::vector<PatternGroup> Groups;
+
+public:
+	/* Returns the index to get the result of this pattern with */
+	inline int32_t AddPattern(const BytePattern& Pattern, VerifyFuncType Verify = nullptr)
+	{
+		const int32_t EntryIndex = static_cast<int32_t>(Entries.size());
+		Entries.push_back(PatternEntry{ std::move(Verify), nullptr });
+
+		PatternGroup* Group = nullptr;
+
+		for (PatternGroup& ExistingGroup : Groups)
+		{
+			if (ExistingGroup.Pattern == Pattern)
+			{
+				Group = &ExistingGroup;
+				break;
+			}
+		}
+
+		if (!Group)
+			Group = &Groups.emplace_back(PatternGroup{ Pattern, {}, 0x0 });
+
+		Group->EntryIndices.push_back(EntryIndex);
+		Group->NumUnresolved++;
+
+		return EntryIndex;
+	}
+
+	/* Finds the first match of all patterns which weren't found by a previous Scan() yet, the memory up to 'Start + Range' must be readable */
+	inline void Scan(const uint8_t* Start, size_t Range)
+	{
+		for (size_t ChunkStart = 0x0; ChunkStart < Range && !HasFoundAll(); ChunkStart += ChunkSize)
+		{
+			for (PatternGroup& Group : Groups)
+			{
+				if (Group.NumUnresolved == 0x0 || Group.Pattern.Size() > Range)
+					continue;
+
+				const size_t NumPositions = Range - Group.Pattern.Size() + 1;
+
+				if (ChunkStart >= NumPositions)
+					continue;
+
+				const size_t NumChunkPositions = (NumPositions - ChunkStart) < ChunkSize ? (NumPositions - ChunkStart) : ChunkSize;
+
+				PatternScanUtils::ForEachMatch(Group.Pattern, Start + ChunkStart, NumChunkPositions, [this, &Group](const uint8_t* Match) -> bool
+				{
+					for (const int32_t EntryIndex : Group.EntryIndices)
+					{
+						PatternEntry& Entry = Entries[EntryIndex];
+
+						if (Entry.Result || (Entry.Verify && !Entry.Verify(Match)))
+							continue;
+
+						Entry.Result = Match;
+						Group.NumUnresolved--;
+					}
+
+					return Group.NumUnresolved == 0x0;
+				});
+			}
+		}
+	}
+
+	/* Clears all results, the patterns are kept */
+	inline void Reset()
+	{
+		for (PatternEntry& Entry : Entries)
+			Entry.Result = nullptr;
+
+		for (PatternGroup& Group : Groups)
+			Group.NumUnresolved = static_cast<int32_t>(Group.EntryIndices.size());
+	}
+
+public:
+	inline const uint8_t* GetResult(int32_t Index) const
+	{
+		return Entries[Index].Result;
+	}
+
+	inline bool HasFoundAll() const
+	{
+		for (const PatternGroup& Group : Groups)
+		{
+			if (Group.NumUnresolved > 0x0)
+				return false;
+		}
+
+		return true;
+	}
+};
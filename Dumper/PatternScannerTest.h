@@ -0,0 +1,359 @@
+#pragma once
+#include <chrono>
+#include <random>
+#include <format>
+#include <string>
+#include "PatternScanner.h"
+#include "TestBase.h"
+
+/* Runs on synthetic PE-like buffers, doesn't require a game or Windows */
+class PatternScannerTest : protected TestBase
+{
+private:
+	struct SyntheticImage
+	{
+		std::vector<uint8_t> Memory;
+
+		size_t TextStart;
+		size_t TextSize;
+		size_t RDataStart;
+		size_t RDataSize;
+
+		/* Offsets of the strings in .rdata and of the lea-instructions referencing them in .text */
+		std::vector<std::string> Strings;
+		std::vector<size_t> StringOffsets;
+		std::vector<size_t> LeaOffsets;
+	};
+
+	/* Uses the same image for all tests */
+	static inline const SyntheticImage& GetImage()
+	{
+		static const SyntheticImage Image = CreateImage(0x4000000, 0x40);
+
+		return Image;
+	}
+
+	/* .text with a byte-distribution similar to x64 code, .rdata with strings referenced by lea-instructions, like "48 8D 0D ? ? ? ?" */
+	static inline SyntheticImage CreateImage(size_t TextSize, int32_t NumStrings)
+	{
+		/* Common opcodes, prefixes, ModRM-bytes and small immediates */
+		constexpr uint8_t CommonBytes[] = { 0x00, 0x48, 0x8B, 0x89, 0x8D, 0x4C, 0x24, 0x44, 0x0F, 0xE8, 0xFF, 0xC3, 0xCC, 0x83, 0x85, 0x74, 0x75, 0x01, 0x08, 0x10, 0x20, 0x40, 0xC0, 0xC8 };
+
+		SyntheticImage Image;
+
+		Image.TextStart = 0x1000;
+		Image.TextSize = TextSize;
+		Image.RDataStart = Image.TextStart + TextSize;
+		Image.RDataSize = 0x10000;
+
+		Image.Memory.resize(Image.RDataStart + Image.RDataSize + 0x1000);
+
+		std::mt19937 Rng(0x7);
+		std::uniform_int_distribution<int> ByteDist(0x0, 0xFF);
+		std::uniform_int_distribution<int> CommonDist(0x0, static_cast<int>(sizeof(CommonBytes) - 1));
+
+		for (size_t i = Image.TextStart; i < Image.RDataStart; i++)
+			Image.Memory[i] = (ByteDist(Rng) & 0x1) ? CommonBytes[CommonDist(Rng)] : static_cast<uint8_t>(ByteDist(Rng));
+
+		size_t StringOffset = Image.RDataStart;
+		std::uniform_int_distribution<size_t> TextDist(Image.TextStart, Image.RDataStart - 0x10);
+
+		for (int32_t i = 0; i < NumStrings; i++)
+		{
+			std::string String = "SyntheticString_" + std::to_string(i) + "_" + std::to_string(Rng());
+
+			memcpy(Image.Memory.data() + StringOffset, String.c_str(), String.size() + 1);
+
+			/* lea rcx, [rip + String] */
+			const size_t LeaOffset = TextDist(Rng);
+			const int32_t Displacement = static_cast<int32_t>(StringOffset - (LeaOffset + 0x7));
+
+			Image.Memory[LeaOffset + 0] = 0x48;
+			Image.Memory[LeaOffset + 1] = 0x8D;
+			Image.Memory[LeaOffset + 2] = 0x0D;
+			memcpy(Image.Memory.data() + LeaOffset + 3, &Displacement, sizeof(Displacement));
+
+			Image.Strings.push_back(std::move(String));
+			Image.StringOffsets.push_back(StringOffset);
+			Image.LeaOffsets.push_back(LeaOffset);
+
+			StringOffset += Image.Strings.back().size() + 1;
+		}
+
+		return Image;
+	}
+
+	/* The previous implementation of FindPatternInRange, byte by byte for every position */
+	static inline const uint8_t* FindPatternReference(const std::vector<int>& Signature, const uint8_t* Start, size_t Range)
+	{
+		for (size_t i = 0; i < (Range - Signature.size()); i++)
+		{
+			bool bFound = true;
+
+			for (size_t j = 0; j < Signature.size(); j++)
+			{
+				if (Start[i + j] != Signature[j] && Signature[j] != -1)
+				{
+					bFound = false;
+					break;
+				}
+			}
+
+			if (bFound)
+				return Start + i;
+		}
+
+		return nullptr;
+	}
+
+	/* Patterns copied from random positions of .text, every 3rd byte is a wildcard. Some of them don't exist anywhere else. */
+	static inline std::vector<std::vector<int>> CreateSignatures(int32_t NumSignatures, int32_t Length)
+	{
+		const SyntheticImage& Image = GetImage();
+
+		std::mt19937 Rng(0x3);
+		std::uniform_int_distribution<size_t> TextDist(Image.TextStart, Image.RDataStart - Length);
+
+		std::vector<std::vector<int>> Signatures;
+
+		for (int32_t i = 0; i < NumSignatures; i++)
+		{
+			const size_t Offset = TextDist(Rng);
+
+			std::vector<int> Signature;
+
+			for (int32_t j = 0; j < Length; j++)
+				Signature.push_back((j % 3 == 1) ? -1 : Image.Memory[Offset + j]);
+
+			Signatures.push_back(std::move(Signature));
+		}
+
+		return Signatures;
+	}
+
+	/* Matches "48 8D ? ? ? ? ?" and "4C 8D ? ? ? ? ?" with a RIP-relative ModRM byte */
+	static inline BytePattern GetRipRelativeLeaPattern()
+	{
+		return BytePattern({ 0x48, 0x8D, 0x05, 0x00, 0x00, 0x00, 0x00 }, { 0xFB, 0xFF, 0xC7, 0x00, 0x00, 0x00, 0x00 });
+	}
+
+	static inline MultiPatternScanner::VerifyFuncType CreateStringVerifier(const std::string& String)
+	{
+		return [&String](const uint8_t* Match) -> bool
+		{
+			const uint8_t* Target = Match + 0x7 + *reinterpret_cast<const int32_t*>(Match + 0x3);
+			const SyntheticImage& Image = GetImage();
+
+			if (Target < Image.Memory.data() || Target + String.size() > Image.Memory.data() + Image.Memory.size())
+				return false;
+
+			return memcmp(Target, String.c_str(), String.size()) == 0;
+		};
+	}
+
+public:
+	template<bool bDoDebugPrinting = false>
+	static inline void TestAll()
+	{
+		TestParsing<bDoDebugPrinting>();
+		TestFindFirst<bDoDebugPrinting>();
+		TestMultiPatternScanner<bDoDebugPrinting>();
+		TestStringReferences<bDoDebugPrinting>();
+		TestScanSpeed<bDoDebugPrinting>();
+
+		PrintDbgMessage<bDoDebugPrinting>("");
+	}
+
+	template<bool bDoDebugPrinting = false>
+	static inline void TestParsing()
+	{
+		bool bSuccededTestWithoutError = true;
+
+		const BytePattern Pattern("48 8D ?? ? E8");
+		SetBoolIfFailed(bSuccededTestWithoutError, Pattern.Size() == 0x5 && Pattern.GetFirstFixedIdx() == 0x0 && Pattern.GetLastFixedIdx() == 0x4);
+		SetBoolIfFailed(bSuccededTestWithoutError, Pattern.GetMask(0x2) == 0x0 && Pattern.GetMask(0x3) == 0x0 && Pattern.GetByte(0x4) == 0xE8);
+
+		/* Missing space between two bytes */
+		SetBoolIfFailed(bSuccededTestWithoutError, !BytePattern("48 8D ? ? 48 8B ? E848 8D").CanMatch());
+		SetBoolIfFailed(bSuccededTestWithoutError, !BytePattern(std::vector<int>{ 0x48, 0x1FF }).CanMatch());
+
+		/* Characters which aren't hex digits or wildcards */
+		SetBoolIfFailed(bSuccededTestWithoutError, !BytePattern("48 8D ZZ E8").CanMatch());
+		SetBoolIfFailed(bSuccededTestWithoutError, !BytePattern("48,8D").CanMatch());
+		SetBoolIfFailed(bSuccededTestWithoutError, !BytePattern("-").CanMatch());
+
+		/* lea r8, [rip + 0x0] and lea rcx, [rsp + 0x8] */
+		const uint8_t RipRelativeLea[] = { 0x4C, 0x8D, 0x05, 0x00, 0x00, 0x00, 0x00 };
+		const uint8_t StackLea[] = { 0x48, 0x8D, 0x4C, 0x24, 0x08, 0x00, 0x00 };
+		SetBoolIfFailed(bSuccededTestWithoutError, GetRipRelativeLeaPattern().MatchesAt(RipRelativeLea));
+		SetBoolIfFailed(bSuccededTestWithoutError, !GetRipRelativeLeaPattern().MatchesAt(StackLea));
+
+		std::cout << __FUNCTION__ << ": " << (bSuccededTestWithoutError ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
+	template<bool bDoDebugPrinting = false>
+	static inline void TestFindFirst()
+	{
+		const SyntheticImage& Image = GetImage();
+
+		const uint8_t* Start = Image.Memory.data() + Image.TextStart;
+		const size_t Range = Image.TextSize;
+
+		bool bSuccededTestWithoutError = true;
+
+		for (const std::vector<int>& Signature : CreateSignatures(0x20, 0x8))
+		{
+			const BytePattern Pattern(Signature);
+			const size_t NumPositions = Range - Signature.size();
+
+			const uint8_t* Expected = FindPatternReference(Signature, Start, Range);
+
+			const uint8_t* Result = PatternScanUtils::FindFirst(Pattern, Start, NumPositions);
+
+			const uint8_t* ResultSSE2 = nullptr;
+			PatternScanUtils::ForEachMatchSSE2(Pattern, Start, NumPositions, [&ResultSSE2](const uint8_t* Match) { ResultSSE2 = Match; return true; });
+
+			if (Result == Expected && ResultSSE2 == Expected)
+				continue;
+
+			PrintDbgMessage<bDoDebugPrinting>("{} --> Expected offset 0x{:X}, got 0x{:X} and 0x{:X} (SSE2)", __FUNCTION__, Expected - Start, Result - Start, ResultSSE2 - Start);
+			bSuccededTestWithoutError = false;
+		}
+
+		std::cout << __FUNCTION__ << ": " << (bSuccededTestWithoutError ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
+	template<bool bDoDebugPrinting = false>
+	static inline void TestMultiPatternScanner()
+	{
+		const SyntheticImage& Image = GetImage();
+
+		const uint8_t* Start = Image.Memory.data() + Image.TextStart;
+		const size_t Range = Image.TextSize;
+
+		const std::vector<std::vector<int>> Signatures = CreateSignatures(0x20, 0x8);
+
+		MultiPatternScanner Scanner;
+
+		for (const std::vector<int>& Signature : Signatures)
+			Scanner.AddPattern(BytePattern(Signature));
+
+		/* Duplicates share one scan, but both need a result */
+		const int32_t DuplicateIndex = Scanner.AddPattern(BytePattern(Signatures[0]));
+
+		Scanner.Scan(Start, Range);
+
+		bool bSuccededTestWithoutError = Scanner.GetResult(DuplicateIndex) == Scanner.GetResult(0x0);
+
+		for (int32_t i = 0; i < static_cast<int32_t>(Signatures.size()); i++)
+		{
+			const uint8_t* Expected = PatternScanUtils::FindFirst(BytePattern(Signatures[i]), Start, Range - Signatures[i].size() + 1);
+
+			if (Scanner.GetResult(i) == Expected)
+				continue;
+
+			PrintDbgMessage<bDoDebugPrinting>("{} --> Pattern {}: Expected offset 0x{:X}, got 0x{:X}", __FUNCTION__, i, Expected - Start, Scanner.GetResult(i) - Start);
+			bSuccededTestWithoutError = false;
+		}
+
+		std::cout << __FUNCTION__ << ": " << (bSuccededTestWithoutError ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
+	template<bool bDoDebugPrinting = false>
+	static inline void TestStringReferences()
+	{
+		const SyntheticImage& Image = GetImage();
+
+		MultiPatternScanner Scanner;
+
+		for (const std::string& String : Image.Strings)
+			Scanner.AddPattern(GetRipRelativeLeaPattern(), CreateStringVerifier(String));
+
+		Scanner.Scan(Image.Memory.data() + Image.TextStart, Image.TextSize);
+
+		bool bSuccededTestWithoutError = true;
+
+		for (int32_t i = 0; i < static_cast<int32_t>(Image.Strings.size()); i++)
+		{
+			if (Scanner.GetResult(i) == Image.Memory.data() + Image.LeaOffsets[i])
+				continue;
+
+			PrintDbgMessage<bDoDebugPrinting>("{} --> Reference to \"{}\" wasn't found", __FUNCTION__, Image.Strings[i]);
+			bSuccededTestWithoutError = false;
+		}
+
+		std::cout << __FUNCTION__ << ": " << (bSuccededTestWithoutError ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
+	template<bool bDoDebugPrinting = false>
+	static inline void TestScanSpeed()
+	{
+		const SyntheticImage& Image = GetImage();
+
+		const uint8_t* Start = Image.Memory.data() + Image.TextStart;
+		const size_t Range = Image.TextSize;
+
+		/* Signatures from the end of .text are found late, like most real signatures */
+		const std::vector<std::vector<int>> Signatures = CreateSignatures(0x10, 0xA);
+
+		auto TimeMs = [](auto&& Func) -> double
+		{
+			const auto StartTime = std::chrono::high_resolution_clock::now();
+			Func();
+			return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - StartTime).count();
+		};
+
+		uintptr_t Checksum = 0x0;
+
+		const double ReferenceMs = TimeMs([&]()
+		{
+			for (const std::vector<int>& Signature : Signatures)
+				Checksum += reinterpret_cast<uintptr_t>(FindPatternReference(Signature, Start, Range));
+		});
+
+		const double SSE2Ms = TimeMs([&]()
+		{
+			for (const std::vector<int>& Signature : Signatures)
+			{
+				PatternScanUtils::ForEachMatchSSE2(BytePattern(Signature), Start, Range - Signature.size(), [&Checksum](const uint8_t* Match) { Checksum += reinterpret_cast<uintptr_t>(Match); return true; });
+			}
+		});
+
+		const double FindFirstMs = TimeMs([&]()
+		{
+			for (const std::vector<int>& Signature : Signatures)
+				Checksum += reinterpret_cast<uintptr_t>(PatternScanUtils::FindFirst(BytePattern(Signature), Start, Range - Signature.size()));
+		});
+
+		const double MultiMs = TimeMs([&]()
+		{
+			MultiPatternScanner Scanner;
+
+			for (const std::vector<int>& Signature : Signatures)
+				Scanner.AddPattern(BytePattern(Signature));
+
+			Scanner.Scan(Start, Range);
+
+			Checksum += reinterpret_cast<uintptr_t>(Scanner.GetResult(0x0));
+		});
+
+		const double StringRefsMs = TimeMs([&]()
+		{
+			MultiPatternScanner Scanner;
+
+			for (const std::string& String : Image.Strings)
+				Scanner.AddPattern(GetRipRelativeLeaPattern(), CreateStringVerifier(String));
+
+			Scanner.Scan(Start, Range);
+
+			Checksum += reinterpret_cast<uintptr_t>(Scanner.GetResult(0x0));
+		});
+
+		PrintDbgMessage<bDoDebugPrinting>("{} --> {} patterns over 0x{:X} bytes (Checksum: 0x{:X})", __FUNCTION__, Signatures.size(), Range, Checksum);
+		PrintDbgMessage<bDoDebugPrinting>("{} --> Reference: {:.2f}ms, SSE2: {:.2f}ms, {}: {:.2f}ms, MultiPatternScanner: {:.2f}ms", __FUNCTION__,
+			ReferenceMs, SSE2Ms, (PatternScanUtils::IsAVX2Supported() ? "AVX2" : "SSE2"), FindFirstMs, MultiMs);
+		PrintDbgMessage<bDoDebugPrinting>("{} --> References to {} strings in one scan: {:.2f}ms", __FUNCTION__, Image.Strings.size(), StringRefsMs);
+
+		std::cout << __FUNCTION__ << ": " << std::format("{:.2f}x faster than the reference, {:.2f}x with a single scan", ReferenceMs / FindFirstMs, ReferenceMs / MultiMs) << std::endl;
+	}
+};
@@ -0,0 +1,127 @@
+#include <algorithm>
+
+#include "PropertyTypeCache.h"
+#include "StructWrapper.h"
+
+
+PropertyTypeKey::PropertyTypeKey(UEProperty Property, int32 PackageIndex)
+{
+	if (AddProperty(Property, PackageIndex)) [[likely]]
+		return;
+
+	/* Types nested too deep are only cached for this exact property */
+	NumWords = 0x0;
+	Add(AddressKeyMarker);
+	Add(reinterpret_cast<uint64>(Property.GetAddress()));
+	Add(static_cast<uint64>(PackageIndex));
+}
+
+bool PropertyTypeKey::AddProperty(UEProperty Property, int32 PackageIndex)
+{
+	auto GetObjectIndex = [](UEObject Obj) -> uint64
+	{
+		return Obj ? static_cast<uint64>(Obj.GetIndex()) : ~0ull;
+	};
+
+	auto [Class, FieldClass] = Property.GetClass();
+
+	const EClassCastFlags Flags = Class ? Class.GetCastFlags() : FieldClass.GetCastFlags();
+
+	if (!Add(static_cast<uint64>(Flags)))
+		return false;
+
+	if (Flags & EClassCastFlags::ByteProperty)
+	{
+		return Add(GetObjectIndex(Property.Cast<UEByteProperty>().GetEnum()));
+	}
+	else if (Flags & EClassCastFlags::BoolProperty)
+	{
+		return Add(Property.Cast<UEBoolProperty>().IsNativeBool());
+	}
+	else if (Flags & EClassCastFlags::ClassProperty)
+	{
+		UEClassProperty ClassProperty = Property.Cast<UEClassProperty>();
+
+		return Add(GetObjectIndex(ClassProperty.GetPropertyClass()))
+			&& Add(GetObjectIndex(ClassProperty.GetMetaClass()))
+			&& Add(ClassProperty.HasPropertyFlags(EPropertyFlags::UObjectWrapper));
+	}
+	else if (Flags & (EClassCastFlags::ObjectPropertyBase | EClassCastFlags::ObjectProperty | EClassCastFlags::InterfaceProperty))
+	{
+		return Add(GetObjectIndex(Property.Cast<UEObjectProperty>().GetPropertyClass()));
+	}
+	else if (Flags & EClassCastFlags::StructProperty)
+	{
+		const StructWrapper UnderlayingStruct = Property.Cast<UEStructProperty>().GetUnderlayingStruct();
+
+		return Add(GetObjectIndex(UnderlayingStruct.GetUnrealStruct())) && Add(UnderlayingStruct.IsCyclicWithPackage(PackageIndex));
+	}
+	else if (Flags & EClassCastFlags::ArrayProperty)
+	{
+		return AddProperty(Property.Cast<UEArrayProperty>().GetInnerProperty(), PackageIndex);
+	}
+	else if (Flags & EClassCastFlags::MapProperty)
+	{
+		UEMapProperty MapProperty = Property.Cast<UEMapProperty>();
+
+		return AddProperty(MapProperty.GetKeyProperty(), PackageIndex) && AddProperty(MapProperty.GetValueProperty(), PackageIndex);
+	}
+	else if (Flags & EClassCastFlags::SetProperty)
+	{
+		return AddProperty(Property.Cast<UESetProperty>().GetElementProperty(), PackageIndex);
+	}
+	else if (Flags & EClassCastFlags::EnumProperty)
+	{
+		UEEnumProperty EnumProperty = Property.Cast<UEEnumProperty>();
+
+		if (UEEnum Enum = EnumProperty.GetEnum())
+			return Add(GetObjectIndex(Enum));
+
+		return Add(~0ull) && AddProperty(EnumProperty.GetUnderlayingProperty(), PackageIndex);
+	}
+	else if (Flags & EClassCastFlags::DelegateProperty)
+	{
+		return Add(GetObjectIndex(Property.Cast<UEDelegateProperty>().GetSignatureFunction()));
+	}
+	else if (Flags & EClassCastFlags::MulticasTMulticastInlineDelegateProperty)
+	{
+		return Add(GetObjectIndex(Property.Cast<UEMulticastInlineDelegateProperty>().GetSignatureFunction()));
+	}
+	else if (Flags & EClassCastFlags::FieldPathProperty)
+	{
+		return Add(reinterpret_cast<uint64>(Property.Cast<UEFieldPathProperty>().GetFielClass().GetAddress()));
+	}
+	else if (Flags & EClassCastFlags::OptionalProperty)
+	{
+		UEProperty ValueProperty = Property.Cast<UEOptionalProperty>().GetValueProperty();
+
+		/* Whether the TOptional has an additional 'bool' to check if the value is set */
+		return Add(Property.GetSize() > ValueProperty.GetSize()) && AddProperty(ValueProperty, PackageIndex);
+	}
+
+	/* Primitive types are fully described by their flags, unknown property-types are named after their class */
+	return Add(Class ? reinterpret_cast<uint64>(Class.GetAddress()) : reinterpret_cast<uint64>(FieldClass.GetAddress()));
+}
+
+uint64 PropertyTypeKey::GetHash() const
+{
+	/* 64bit FNV-1a over whole words, the upper half is folded down so cast-flags in the upper bits also change the lower bits used for buckets */
+	constexpr uint64 FNVOffsetBasis = 0xCBF29CE484222325;
+	constexpr uint64 FNVPrime = 0x100000001B3;
+
+	uint64 Hash = FNVOffsetBasis;
+
+	for (int32 i = 0; i < NumWords; i++)
+	{
+		Hash ^= Words[i];
+		Hash *= FNVPrime;
+		Hash ^= Hash >> 32;
+	}
+
+	return Hash;
+}
+
+bool PropertyTypeKey::operator==(const PropertyTypeKey& Other) const
+{
+	return NumWords == Other.NumWords && std::equal(Words.begin(), Words.begin() + NumWords, Other.Words.begin());
+}
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include "Enums.h"
+#include "UnrealObjects.h"
+
+
+/*
+* Structural identity of a property-type, two properties with equal keys result in the same type-string.
+*
+* Every property in the type adds its cast-flags, the object it references (enum, class, meta-class, struct, signature-function or field-class)
+* and the flags changing the generated type. Inner properties (Array, Set, Map, Optional, Enum) add their keys recursively.
+*
+* StructProperties add whether the struct needs a cycle-fixup in the requested package, instead of the package-index itself,
+* so the type is only cached per-package where the result actually differs.
+*/
+class PropertyTypeKey
+{
+public:
+	struct Hasher
+	{
+		inline size_t operator()(const PropertyTypeKey& Key) const
+		{
+			return static_cast<size_t>(Key.GetHash());
+		}
+	};
+
+private:
+	/* Enough for 5 levels of nested properties, deeper types fall back to the identity of the property */
+	static constexpr int32 MaxNumWords = 0x10;
+
+	/* Marks a key made from the address of the property, which can't collide with cast-flags */
+	static constexpr uint64 AddressKeyMarker = ~0ull;
+
+private:
+	std::array<uint64, MaxNumWords> Words;
+	int32 NumWords = 0x0;
+
+public:
+	PropertyTypeKey(UEProperty Property, int32 PackageIndex);
+
+private:
+	/* Returns false if the key got too long */
+	bool AddProperty(UEProperty Property, int32 PackageIndex);
+
+	inline bool Add(uint64 Value)
+	{
+		if (NumWords >= MaxNumWords)
+			return false;
+
+		Words[NumWords++] = Value;
+		return true;
+	}
+
+public:
+	uint64 GetHash() const;
+
+	bool operator==(const PropertyTypeKey& Other) const;
+};
+
+
+/*
+* Thread-safe cache of type-descriptions of properties, keyed by their PropertyTypeKey. Each generator owns one cache for its own type-representation.
+*
+* Values are created once and never moved or removed until Clear() is called, so references returned by FindOrAdd() can be kept and shared between threads.
+*/
+template<typename ValueType>
+class PropertyTypeCache
+{
+private:
+	/* Independent maps with their own lock, to reduce contention when packages are generated on multiple threads */
+	static constexpr int32 NumShards = 0x10;
+
+	struct Shard
+	{
+		std::shared_mutex Mutex;
+		std::unordered_map<PropertyTypeKey, ValueType, PropertyTypeKey::Hasher> Values;
+	};
+
+private:
+	std::array<Shard, NumShards> Shards;
+
+	std::atomic<uint64> NumHits = 0x0;
+	std::atomic<uint64> NumMisses = 0x0;
+
+public:
+	/* 'CreateValue' is called without a lock being held, so it can look up the types of inner properties recursively */
+	template<typename CreateFuncType>
+	inline const ValueType& FindOrAdd(UEProperty Property, int32 PackageIndex, CreateFuncType&& CreateValue)
+	{
+		PropertyTypeKey Key(Property, PackageIndex);
+
+		Shard& TargetShard = Shards[Key.GetHash() % NumShards];
+
+		{
+			std::shared_lock Lock(TargetShard.Mutex);
+
+			auto It = TargetShard.Values.find(Key);
+
+			if (It != TargetShard.Values.end()) [[likely]]
+			{
+				NumHits.fetch_add(1, std::memory_order_relaxed);
+				return It->second;
+			}
+		}
+
+		NumMisses.fetch_add(1, std::memory_order_relaxed);
+
+		ValueType NewValue = CreateValue();
+
+		std::unique_lock Lock(TargetShard.Mutex);
+
+		/* Another thread might have added the same type in the meantime, the existing value is kept then */
+		return TargetShard.Values.try_emplace(Key, std::move(NewValue)).first->second;
+	}
+
+	inline void Clear()
+	{
+		for (Shard& CurrentShard : Shards)
+		{
+			std::unique_lock Lock(CurrentShard.Mutex);
+			CurrentShard.Values.clear();
+		}
+
+		NumHits = 0x0;
+		NumMisses = 0x0;
+	}
+
+public:
+	inline uint64 GetNumHits() const { return NumHits; }
+	inline uint64 GetNumMisses() const { return NumMisses; }
+};
@@ -0,0 +1,662 @@
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <vector>
+#include <unordered_map>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "ReflectionSnapshot.h"
+#include "ObjectArray.h"
+#include "Offsets.h"
+#include "Settings.h"
+
+using namespace Snapshot;
+
+
+struct SnapshotFlagEntry
+{
+	EEngineFlags Flag;
+	bool* Value;
+};
+
+struct SnapshotOffsetEntry
+{
+	const char* Name;
+	int32* Value;
+};
+
+/* Booleans which are required to interpret the captured data/generate the SDK, shared between Write() and ApplySettingsAndOffsets() */
+static const SnapshotFlagEntry SnapshotFlags[] = {
+	{ EEngineFlags::EnumNameOnly, &Settings::Internal::bIsEnumNameOnly },
+	{ EEngineFlags::SmallEnumValue, &Settings::Internal::bIsSmallEnumValue },
+	{ EEngineFlags::WeakObjectPtrWithoutTag, &Settings::Internal::bIsWeakObjectPtrWithoutTag },
+	{ EEngineFlags::UseFProperty, &Settings::Internal::bUseFProperty },
+	{ EEngineFlags::UseNamePool, &Settings::Internal::bUseNamePool },
+	{ EEngineFlags::ObjectNameBeforeClass, &Settings::Internal::bIsObjectNameBeforeClass },
+	{ EEngineFlags::UseCasePreservingName, &Settings::Internal::bUseCasePreservingName },
+	{ EEngineFlags::UseOutlineNumberName, &Settings::Internal::bUseOutlineNumberName },
+	{ EEngineFlags::UseMaskForFieldOwner, &Settings::Internal::bUseMaskForFieldOwner },
+	{ EEngineFlags::UseLargeWorldCoordinates, &Settings::Internal::bUseLargeWorldCoordinates },
+	{ EEngineFlags::IsChunkedObjectArray, &Off::FUObjectArray::bIsChunked },
+	{ EEngineFlags::IsUsingAppendStringOverToString, &Off::InSDK::Name::bIsUsingAppendStringOverToString },
+};
+
+/* Offsets written into the generated SDK, shared between Write() and ApplySettingsAndOffsets() */
+static const SnapshotOffsetEntry SnapshotOffsets[] = {
+	{ "InSDK::ProcessEvent::PEIndex", &Off::InSDK::ProcessEvent::PEIndex },
+	{ "InSDK::ProcessEvent::PEOffset", &Off::InSDK::ProcessEvent::PEOffset },
+	{ "InSDK::World::GWorld", &Off::InSDK::World::GWorld },
+	{ "InSDK::ObjArray::GObjects", &Off::InSDK::ObjArray::GObjects },
+	{ "InSDK::ObjArray::ChunkSize", &Off::InSDK::ObjArray::ChunkSize },
+	{ "InSDK::ObjArray::FUObjectItemSize", &Off::InSDK::ObjArray::FUObjectItemSize },
+	{ "InSDK::ObjArray::FUObjectItemInitialOffset", &Off::InSDK::ObjArray::FUObjectItemInitialOffset },
+	{ "InSDK::Name::AppendNameToString", &Off::InSDK::Name::AppendNameToString },
+	{ "InSDK::Name::FNameSize", &Off::InSDK::Name::FNameSize },
+	{ "InSDK::NameArray::GNames", &Off::InSDK::NameArray::GNames },
+	{ "InSDK::NameArray::FNamePoolBlockOffsetBits", &Off::InSDK::NameArray::FNamePoolBlockOffsetBits },
+	{ "InSDK::NameArray::FNameEntryStride", &Off::InSDK::NameArray::FNameEntryStride },
+	{ "InSDK::Properties::PropertySize", &Off::InSDK::Properties::PropertySize },
+	{ "InSDK::Text::TextDatOffset", &Off::InSDK::Text::TextDatOffset },
+	{ "InSDK::Text::InTextDataStringOffset", &Off::InSDK::Text::InTextDataStringOffset },
+	{ "InSDK::Text::TextSize", &Off::InSDK::Text::TextSize },
+	{ "InSDK::ULevel::Actors", &Off::InSDK::ULevel::Actors },
+	{ "InSDK::UDataTable::RowMap", &Off::InSDK::UDataTable::RowMap },
+};
+
+
+/* Collects all records in memory before they're written to the file in one go */
+struct SnapshotBuilder
+{
+	std::string Strings;
+	std::unordered_map<std::string, StringRef> StringLookup;
+
+	std::vector<ObjectRecord> Objects;
+	std::vector<StructRecord> Structs;
+	std::vector<PropertyRecord> Properties;
+	std::vector<EnumRecord> Enums;
+	std::vector<EnumValueRecord> EnumValues;
+	std::vector<OffsetRecord> Offsets;
+
+	StringRef AddString(const std::string& Str)
+	{
+		auto [It, bInserted] = StringLookup.try_emplace(Str);
+
+		if (bInserted)
+		{
+			It->second = { static_cast<uint32>(Strings.size()), static_cast<uint32>(Str.size()) };
+			Strings += Str;
+		}
+
+		return It->second;
+	}
+
+	static inline int32 GetIndexOrInvalid(UEObject Obj)
+	{
+		return Obj ? Obj.GetIndex() : -1;
+	}
+
+	int32 AddProperties(const std::vector<UEProperty>& Props)
+	{
+		const int32 FirstIndex = static_cast<int32>(Properties.size());
+
+		/* Reserve a contiguous range first, inner properties are appended behind it */
+		Properties.resize(Properties.size() + Props.size());
+
+		for (int i = 0; i < Props.size(); i++)
+		{
+			/* Don't keep a reference, MakePropertyRecord() might reallocate 'Properties' */
+			PropertyRecord Record = MakePropertyRecord(Props[i]);
+			Properties[FirstIndex + i] = Record;
+		}
+
+		return FirstIndex;
+	}
+
+	PropertyRecord MakePropertyRecord(UEProperty Prop)
+	{
+		PropertyRecord Record = {};
+		Record.Name = AddString(Prop.GetName());
+		Record.ClassName = AddString(Prop.GetPropClassName());
+		Record.CastFlags = Prop.GetCastFlags();
+		Record.PropertyFlags = Prop.GetPropertyFlags();
+		Record.Offset = Prop.GetOffset();
+		Record.Size = Prop.GetSize();
+		Record.ArrayDim = Prop.GetArrayDim();
+		Record.ObjectRef = -1;
+		Record.MetaClassRef = -1;
+		Record.FirstInner = -1;
+
+		std::vector<UEProperty> InnerProperties;
+
+		const EClassCastFlags TypeFlags = Record.CastFlags;
+
+		if (TypeFlags & EClassCastFlags::ByteProperty)
+		{
+			Record.ObjectRef = GetIndexOrInvalid(Prop.Cast<UEByteProperty>().GetEnum());
+		}
+		else if (TypeFlags & EClassCastFlags::BoolProperty)
+		{
+			Record.FieldMask = Prop.Cast<UEBoolProperty>().GetFieldMask();
+			Record.BitIndex = Prop.Cast<UEBoolProperty>().GetBitIndex();
+		}
+		else if (TypeFlags & EClassCastFlags::ObjectPropertyBase)
+		{
+			Record.ObjectRef = GetIndexOrInvalid(Prop.Cast<UEObjectProperty>().GetPropertyClass());
+
+			if (TypeFlags & EClassCastFlags::ClassProperty || TypeFlags & EClassCastFlags::SoftClassProperty)
+				Record.MetaClassRef = GetIndexOrInvalid(Prop.Cast<UEClassProperty>().GetMetaClass());
+		}
+		else if (TypeFlags & EClassCastFlags::StructProperty)
+		{
+			Record.ObjectRef = GetIndexOrInvalid(Prop.Cast<UEStructProperty>().GetUnderlayingStruct());
+		}
+		else if (TypeFlags & EClassCastFlags::DelegateProperty)
+		{
+			Record.ObjectRef = GetIndexOrInvalid(Prop.Cast<UEDelegateProperty>().GetSignatureFunction());
+		}
+		else if (TypeFlags & EClassCastFlags::MulticasTMulticastInlineDelegateProperty)
+		{
+			Record.ObjectRef = GetIndexOrInvalid(Prop.Cast<UEMulticastInlineDelegateProperty>().GetSignatureFunction());
+		}
+		else if (TypeFlags & EClassCastFlags::ArrayProperty)
+		{
+			InnerProperties.push_back(Prop.Cast<UEArrayProperty>().GetInnerProperty());
+		}
+		else if (TypeFlags & EClassCastFlags::MapProperty)
+		{
+			InnerProperties.push_back(Prop.Cast<UEMapProperty>().GetKeyProperty());
+			InnerProperties.push_back(Prop.Cast<UEMapProperty>().GetValueProperty());
+		}
+		else if (TypeFlags & EClassCastFlags::SetProperty)
+		{
+			InnerProperties.push_back(Prop.Cast<UESetProperty>().GetElementProperty());
+		}
+		else if (TypeFlags & EClassCastFlags::EnumProperty)
+		{
+			Record.ObjectRef = GetIndexOrInvalid(Prop.Cast<UEEnumProperty>().GetEnum());
+			InnerProperties.push_back(Prop.Cast<UEEnumProperty>().GetUnderlayingProperty());
+		}
+		else if (TypeFlags & EClassCastFlags::FieldPathProperty)
+		{
+			UEFFieldClass FieldClass = Prop.Cast<UEFieldPathProperty>().GetFielClass();
+
+			if (FieldClass)
+				Record.ExtraName = AddString(FieldClass.GetName());
+		}
+		else if (TypeFlags & EClassCastFlags::OptionalProperty)
+		{
+			InnerProperties.push_back(Prop.Cast<UEOptionalProperty>().GetValueProperty());
+		}
+
+		/* Invalid inner properties can occure for properties the engine failed to link */
+		std::erase_if(InnerProperties, [](UEProperty Inner) { return !Inner; });
+
+		if (!InnerProperties.empty())
+		{
+			Record.FirstInner = AddProperties(InnerProperties);
+			Record.NumInner = static_cast<int32>(InnerProperties.size());
+		}
+
+		return Record;
+	}
+
+	void AddObject(UEObject Obj, int32 Index)
+	{
+		ObjectRecord Record = {};
+		Record.Index = -1;
+		Record.ClassIndex = -1;
+		Record.OuterIndex = -1;
+		Record.StructRecordIndex = -1;
+		Record.EnumRecordIndex = -1;
+
+		if (!Obj)
+		{
+			Objects.push_back(Record);
+			return;
+		}
+
+		Record.Index = Index;
+		Record.ClassIndex = GetIndexOrInvalid(Obj.GetClass());
+		Record.OuterIndex = GetIndexOrInvalid(Obj.GetOuter());
+		Record.Flags = Obj.GetFlags();
+		Record.ClassCastFlags = Obj.GetClass() ? Obj.GetClass().GetCastFlags() : EClassCastFlags::None;
+		Record.Name = AddString(Obj.GetName());
+
+		if (Obj.IsA(EClassCastFlags::Struct))
+		{
+			const UEStruct Struct = Obj.Cast<UEStruct>();
+
+			StructRecord StructInfo = {};
+			StructInfo.ObjectIndex = Index;
+			StructInfo.SuperIndex = GetIndexOrInvalid(Struct.GetSuper());
+			StructInfo.Size = Struct.GetStructSize();
+			StructInfo.MinAlignment = Struct.GetMinAlignment();
+
+			if (Obj.IsA(EClassCastFlags::Class))
+				StructInfo.CastFlags = Obj.Cast<UEClass>().GetCastFlags();
+
+			if (Obj.IsA(EClassCastFlags::Function))
+				StructInfo.FunctionFlags = Obj.Cast<UEFunction>().GetFunctionFlags();
+
+			const std::vector<UEProperty> StructProperties = Struct.GetProperties();
+			StructInfo.FirstProperty = AddProperties(StructProperties);
+			StructInfo.NumProperties = static_cast<int32>(StructProperties.size());
+
+			Record.StructRecordIndex = static_cast<int32>(Structs.size());
+			Structs.push_back(StructInfo);
+		}
+		else if (Obj.IsA(EClassCastFlags::Enum))
+		{
+			EnumRecord EnumInfo = {};
+			EnumInfo.ObjectIndex = Index;
+			EnumInfo.FirstValue = static_cast<int32>(EnumValues.size());
+
+			for (const auto& [Name, Value] : Obj.Cast<UEEnum>().GetNameValuePairs())
+				EnumValues.push_back({ AddString(Name.ToString()), Value });
+
+			EnumInfo.NumValues = static_cast<int32>(EnumValues.size()) - EnumInfo.FirstValue;
+
+			Record.EnumRecordIndex = static_cast<int32>(Enums.size());
+			Enums.push_back(EnumInfo);
+		}
+
+		Objects.push_back(Record);
+	}
+};
+
+
+template<typename RecordType>
+static inline void WriteSection(std::ofstream& File, SnapshotHeader& Header, ESection Section, const RecordType* Records, uint64 Count)
+{
+	constexpr char Padding[0x8] = { 0 };
+
+	/* Align every section to 8 bytes so records can be accessed in-place */
+	const uint64 CurrentPos = static_cast<uint64>(File.tellp());
+	const uint64 AlignedPos = (CurrentPos + 0x7) & ~0x7ull;
+	File.write(Padding, AlignedPos - CurrentPos);
+
+	Header.Sections[static_cast<uint32>(Section)] = { AlignedPos, Count * sizeof(RecordType), Count };
+
+	File.write(reinterpret_cast<const char*>(Records), Count * sizeof(RecordType));
+}
+
+bool ReflectionSnapshot::Write(const fs::path& FilePath)
+{
+	SnapshotBuilder Builder;
+
+	const int32 NumObjects = ObjectArray::Num();
+	Builder.Objects.reserve(NumObjects);
+
+	for (int i = 0; i < NumObjects; i++)
+		Builder.AddObject(ObjectArray::GetByIndex(i), i);
+
+	SnapshotHeader Header = {};
+	Header.Magic = Snapshot::Magic;
+	Header.Version = Snapshot::Version;
+	Header.NumObjects = NumObjects;
+	Header.GameName = Builder.AddString(Settings::Generator::GameName);
+	Header.GameVersion = Builder.AddString(Settings::Generator::GameVersion);
+
+	for (const SnapshotFlagEntry& Entry : SnapshotFlags)
+	{
+		if (*Entry.Value)
+			Header.Flags |= Entry.Flag;
+	}
+
+	for (const SnapshotOffsetEntry& Entry : SnapshotOffsets)
+		Builder.Offsets.push_back({ Builder.AddString(Entry.Name), *Entry.Value });
+
+	std::ofstream File(FilePath, std::ios::binary);
+
+	if (!File.is_open())
+	{
+		std::cout << "ReflectionSnapshot: Error opening file \"" << FilePath.string() << "\"" << std::endl;
+		return false;
+	}
+
+	/* Write a placeholder header, it's rewritten once all section offsets are known */
+	File.write(reinterpret_cast<const char*>(&Header), sizeof(Header));
+
+	WriteSection(File, Header, ESection::Strings, Builder.Strings.data(), Builder.Strings.size());
+	WriteSection(File, Header, ESection::Objects, Builder.Objects.data(), Builder.Objects.size());
+	WriteSection(File, Header, ESection::Structs, Builder.Structs.data(), Builder.Structs.size());
+	WriteSection(File, Header, ESection::Properties, Builder.Properties.data(), Builder.Properties.size());
+	WriteSection(File, Header, ESection::Enums, Builder.Enums.data(), Builder.Enums.size());
+	WriteSection(File, Header, ESection::EnumValues, Builder.EnumValues.data(), Builder.EnumValues.size());
+	WriteSection(File, Header, ESection::Offsets, Builder.Offsets.data(), Builder.Offsets.size());
+
+	File.seekp(0);
+	File.write(reinterpret_cast<const char*>(&Header), sizeof(Header));
+
+	if (!File.good())
+	{
+		std::cout << "ReflectionSnapshot: Error writing file \"" << FilePath.string() << "\"" << std::endl;
+		return false;
+	}
+
+	std::cout << std::format("ReflectionSnapshot: Wrote {} objects, {} structs, {} properties and {} enums.\n", NumObjects, Builder.Structs.size(), Builder.Properties.size(), Builder.Enums.size());
+
+	return true;
+}
+
+
+ReflectionSnapshot::ReflectionSnapshot(ReflectionSnapshot&& Other) noexcept
+	: Data(Other.Data)
+	, DataSize(Other.DataSize)
+	, FileHandle(Other.FileHandle)
+	, MappingHandle(Other.MappingHandle)
+{
+	Other.Data = nullptr;
+	Other.DataSize = 0x0;
+	Other.FileHandle = nullptr;
+	Other.MappingHandle = nullptr;
+}
+
+ReflectionSnapshot::~ReflectionSnapshot()
+{
+	Unload();
+}
+
+ReflectionSnapshot& ReflectionSnapshot::operator=(ReflectionSnapshot&& Other) noexcept
+{
+	if (this == &Other)
+		return *this;
+
+	Unload();
+
+	Data = Other.Data;
+	DataSize = Other.DataSize;
+	FileHandle = Other.FileHandle;
+	MappingHandle = Other.MappingHandle;
+
+	Other.Data = nullptr;
+	Other.DataSize = 0x0;
+	Other.FileHandle = nullptr;
+	Other.MappingHandle = nullptr;
+
+	return *this;
+}
+
+bool ReflectionSnapshot::Load(const fs::path& FilePath)
+{
+	Unload();
+
+#ifdef _WIN32
+	HANDLE File = CreateFileW(FilePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+	if (File == INVALID_HANDLE_VALUE)
+	{
+		std::cout << "ReflectionSnapshot: Error opening file \"" << FilePath.string() << "\"" << std::endl;
+		return false;
+	}
+
+	LARGE_INTEGER FileSize;
+	HANDLE Mapping = GetFileSizeEx(File, &FileSize) && FileSize.QuadPart > 0 ? CreateFileMappingW(File, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr;
+	const void* View = Mapping ? MapViewOfFile(Mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+
+	if (!View)
+	{
+		std::cout << "ReflectionSnapshot: Error mapping file \"" << FilePath.string() << "\"" << std::endl;
+
+		if (Mapping)
+			CloseHandle(Mapping);
+
+		CloseHandle(File);
+		return false;
+	}
+
+	FileHandle = File;
+	MappingHandle = Mapping;
+	DataSize = static_cast<uint64>(FileSize.QuadPart);
+#else
+	const int File = open(FilePath.c_str(), O_RDONLY);
+
+	if (File == -1)
+	{
+		std::cout << "ReflectionSnapshot: Error opening file \"" << FilePath.string() << "\"" << std::endl;
+		return false;
+	}
+
+	struct stat FileInfo;
+	void* View = fstat(File, &FileInfo) == 0 && FileInfo.st_size > 0 ? mmap(nullptr, FileInfo.st_size, PROT_READ, MAP_PRIVATE, File, 0) : MAP_FAILED;
+
+	/* The mapping stays valid after closing the file-descriptor */
+	close(File);
+
+	if (View == MAP_FAILED)
+	{
+		std::cout << "ReflectionSnapshot: Error mapping file \"" << FilePath.string() << "\"" << std::endl;
+		return false;
+	}
+
+	MappingHandle = View;
+	DataSize = static_cast<uint64>(FileInfo.st_size);
+#endif
+
+	Data = static_cast<const uint8*>(View);
+
+	if (!ValidateHeader())
+	{
+		std::cout << "ReflectionSnapshot: File \"" << FilePath.string() << "\" is not a valid snapshot" << std::endl;
+		Unload();
+		return false;
+	}
+
+	return true;
+}
+
+bool ReflectionSnapshot::LoadFromMemory(const uint8* Buffer, uint64 BufferSize)
+{
+	Unload();
+
+	Data = Buffer;
+	DataSize = BufferSize;
+
+	if (!ValidateHeader())
+	{
+		Data = nullptr;
+		DataSize = 0x0;
+		return false;
+	}
+
+	return true;
+}
+
+void ReflectionSnapshot::Unload()
+{
+#ifdef _WIN32
+	if (MappingHandle)
+	{
+		UnmapViewOfFile(Data);
+		CloseHandle(MappingHandle);
+	}
+
+	if (FileHandle)
+		CloseHandle(FileHandle);
+#else
+	if (MappingHandle)
+		munmap(MappingHandle, DataSize);
+#endif
+
+	Data = nullptr;
+	DataSize = 0x0;
+	FileHandle = nullptr;
+	MappingHandle = nullptr;
+}
+
+void ReflectionSnapshot::ApplySettingsAndOffsets() const
+{
+	const SnapshotHeader& Header = GetHeader();
+
+	for (const SnapshotFlagEntry& Entry : SnapshotFlags)
+		*Entry.Value = Header.Flags & Entry.Flag;
+
+	for (const OffsetRecord& Offset : GetOffsets())
+	{
+		const std::string_view Name = GetString(Offset.Name);
+
+		for (const SnapshotOffsetEntry& Entry : SnapshotOffsets)
+		{
+			if (Name == Entry.Name)
+			{
+				*Entry.Value = Offset.Value;
+				break;
+			}
+		}
+	}
+
+	Settings::Generator::GameName = GetString(Header.GameName);
+	Settings::Generator::GameVersion = GetString(Header.GameVersion);
+}
+
+bool ReflectionSnapshot::ValidateHeader() const
+{
+	static constexpr uint64 RecordSizes[] = {
+		sizeof(char),
+		sizeof(ObjectRecord),
+		sizeof(StructRecord),
+		sizeof(PropertyRecord),
+		sizeof(EnumRecord),
+		sizeof(EnumValueRecord),
+		sizeof(OffsetRecord),
+	};
+
+	static_assert(sizeof(RecordSizes) / sizeof(*RecordSizes) == static_cast<uint32>(ESection::Num), "Missing record-size for a section!");
+
+	if (!Data || DataSize < sizeof(SnapshotHeader))
+		return false;
+
+	const SnapshotHeader& Header = GetHeader();
+
+	if (Header.Magic != Snapshot::Magic || Header.Version != Snapshot::Version)
+		return false;
+
+	for (uint32 i = 0; i < static_cast<uint32>(ESection::Num); i++)
+	{
+		const SectionEntry& Section = Header.Sections[i];
+
+		if ((Section.Offset & 0x7) != 0x0 || Section.Size != (Section.Count * RecordSizes[i]))
+			return false;
+
+		if (Section.Offset > DataSize || Section.Size > (DataSize - Section.Offset))
+			return false;
+	}
+
+	return Header.Sections[static_cast<uint32>(ESection::Objects)].Count == static_cast<uint64>(Header.NumObjects);
+}
+
+template<typename RecordType>
+std::span<const RecordType> ReflectionSnapshot::GetSection(ESection Section) const
+{
+	const SectionEntry& Entry = GetHeader().Sections[static_cast<uint32>(Section)];
+
+	return { reinterpret_cast<const RecordType*>(Data + Entry.Offset), static_cast<size_t>(Entry.Count) };
+}
+
+const SnapshotHeader& ReflectionSnapshot::GetHeader() const
+{
+	return *reinterpret_cast<const SnapshotHeader*>(Data);
+}
+
+std::string_view ReflectionSnapshot::GetString(StringRef Ref) const
+{
+	const std::span<const char> Strings = GetSection<char>(ESection::Strings);
+
+	if (Ref.Offset > Strings.size() || Ref.Length > (Strings.size() - Ref.Offset))
+		return {};
+
+	return { Strings.data() + Ref.Offset, Ref.Length };
+}
+
+std::span<const ObjectRecord> ReflectionSnapshot::GetObjects() const
+{
+	return GetSection<ObjectRecord>(ESection::Objects);
+}
+
+std::span<const StructRecord> ReflectionSnapshot::GetStructs() const
+{
+	return GetSection<StructRecord>(ESection::Structs);
+}
+
+std::span<const PropertyRecord> ReflectionSnapshot::GetProperties() const
+{
+	return GetSection<PropertyRecord>(ESection::Properties);
+}
+
+std::span<const EnumRecord> ReflectionSnapshot::GetEnums() const
+{
+	return GetSection<EnumRecord>(ESection::Enums);
+}
+
+std::span<const EnumValueRecord> ReflectionSnapshot::GetEnumValues() const
+{
+	return GetSection<EnumValueRecord>(ESection::EnumValues);
+}
+
+std::span<const OffsetRecord> ReflectionSnapshot::GetOffsets() const
+{
+	return GetSection<OffsetRecord>(ESection::Offsets);
+}
+
+const ObjectRecord* ReflectionSnapshot::GetObjectByIndex(int32 Index) const
+{
+	const std::span<const ObjectRecord> Objects = GetObjects();
+
+	if (Index < 0 || Index >= Objects.size() || Objects[Index].Index == -1)
+		return nullptr;
+
+	return &Objects[Index];
+}
+
+const StructRecord* ReflectionSnapshot::GetStruct(const ObjectRecord& Object) const
+{
+	const std::span<const StructRecord> Structs = GetStructs();
+
+	if (Object.StructRecordIndex < 0 || Object.StructRecordIndex >= Structs.size())
+		return nullptr;
+
+	return &Structs[Object.StructRecordIndex];
+}
+
+const EnumRecord* ReflectionSnapshot::GetEnum(const ObjectRecord& Object) const
+{
+	const std::span<const EnumRecord> Enums = GetEnums();
+
+	if (Object.EnumRecordIndex < 0 || Object.EnumRecordIndex >= Enums.size())
+		return nullptr;
+
+	return &Enums[Object.EnumRecordIndex];
+}
+
+/* Returns an empty span for ranges exceeding 'Records', snapshots can come from untrusted files */
+template<typename RecordType>
+static inline std::span<const RecordType> GetSubRange(std::span<const RecordType> Records, int32 First, int32 Count)
+{
+	if (First < 0 || Count <= 0 || First > Records.size() || Count > (Records.size() - First))
+		return {};
+
+	return Records.subspan(First, Count);
+}
+
+std::span<const PropertyRecord> ReflectionSnapshot::GetProperties(const StructRecord& Struct) const
+{
+	return GetSubRange(GetProperties(), Struct.FirstProperty, Struct.NumProperties);
+}
+
+std::span<const PropertyRecord> ReflectionSnapshot::GetInnerProperties(const PropertyRecord& Property) const
+{
+	return GetSubRange(GetProperties(), Property.FirstInner, Property.NumInner);
+}
+
+std::span<const EnumValueRecord> ReflectionSnapshot::GetEnumValues(const EnumRecord& Enum) const
+{
+	return GetSubRange(GetEnumValues(), Enum.FirstValue, Enum.NumValues);
+}
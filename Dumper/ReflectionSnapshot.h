@@ -0,0 +1,231 @@
+#pragma once
+
+#include <span>
+#include <string>
+#include <string_view>
+#include <filesystem>
+
+#include "Enums.h"
+
+namespace fs = std::filesystem;
+
+
+/*
+* Binary snapshot of the reflection data consumed by the generators.
+*
+* The file consists of a 'SnapshotHeader' followed by sections of trivially-copyable records. Sections are 8-byte aligned, so a
+* loaded snapshot is used in-place from the mapped file without any parsing or copying. References between records are indices
+* (GObjects-indices for objects, record-indices for properties/enum-values), strings are UTF-8 and stored in a single string section.
+*/
+namespace Snapshot
+{
+	constexpr uint32 Magic = 0x534E5337; // "7SNS"
+	constexpr uint32 Version = 1;
+
+	enum class ESection : uint32
+	{
+		Strings,
+		Objects,
+		Structs,
+		Properties,
+		Enums,
+		EnumValues,
+		Offsets,
+
+		Num
+	};
+
+	/* Flags corresponding to Settings::Internal and layout-related booleans in Off:: */
+	enum class EEngineFlags : uint32
+	{
+		None                            = 0x0000,
+		EnumNameOnly                    = 0x0001,
+		SmallEnumValue                  = 0x0002,
+		WeakObjectPtrWithoutTag         = 0x0004,
+		UseFProperty                    = 0x0008,
+		UseNamePool                     = 0x0010,
+		ObjectNameBeforeClass           = 0x0020,
+		UseCasePreservingName           = 0x0040,
+		UseOutlineNumberName            = 0x0080,
+		UseMaskForFieldOwner            = 0x0100,
+		UseLargeWorldCoordinates        = 0x0200,
+		IsChunkedObjectArray            = 0x0400,
+		IsUsingAppendStringOverToString = 0x0800,
+	};
+
+	struct StringRef
+	{
+		uint32 Offset = 0x0;
+		uint32 Length = 0x0;
+	};
+
+	struct SectionEntry
+	{
+		uint64 Offset;
+		uint64 Size;
+		uint64 Count;
+	};
+
+	struct SnapshotHeader
+	{
+		uint32 Magic;
+		uint32 Version;
+		EEngineFlags Flags;
+		int32 NumObjects;
+
+		StringRef GameName;
+		StringRef GameVersion;
+
+		SectionEntry Sections[static_cast<uint32>(ESection::Num)];
+	};
+
+	/* One record per GObjects slot. Empty slots have 'Index' == -1. */
+	struct ObjectRecord
+	{
+		int32 Index;
+		int32 ClassIndex;
+		int32 OuterIndex;
+
+		/* Index into the Structs/Enums section, -1 if this object is neither */
+		int32 StructRecordIndex;
+		int32 EnumRecordIndex;
+
+		EObjectFlags Flags;
+		EClassCastFlags ClassCastFlags; // CastFlags of the objects class
+
+		StringRef Name;
+	};
+
+	struct StructRecord
+	{
+		int32 ObjectIndex;
+		int32 SuperIndex;
+
+		int32 Size;
+		int32 MinAlignment;
+
+		/* Range in the Properties section, in the order returned by UEStruct::GetProperties() */
+		int32 FirstProperty;
+		int32 NumProperties;
+
+		EClassCastFlags CastFlags;      // UClass only
+		EFunctionFlags FunctionFlags;   // UFunction only
+	};
+
+	struct PropertyRecord
+	{
+		StringRef Name;
+		StringRef ClassName;
+
+		/* FieldClass-name for FieldPathProperty */
+		StringRef ExtraName;
+
+		EClassCastFlags CastFlags;
+		EPropertyFlags PropertyFlags;
+
+		int32 Offset;
+		int32 Size;
+		int32 ArrayDim;
+
+		/* Enum, PropertyClass, Struct or SignatureFunction, depending on the type */
+		int32 ObjectRef;
+		/* MetaClass of Class-/SoftClassProperty */
+		int32 MetaClassRef;
+
+		/* Range in the Properties section for Inner/Key+Value/Element/Underlaying/Value properties */
+		int32 FirstInner;
+		int32 NumInner;
+
+		uint8 FieldMask;
+		uint8 BitIndex;
+	};
+
+	struct EnumRecord
+	{
+		int32 ObjectIndex;
+
+		int32 FirstValue;
+		int32 NumValues;
+	};
+
+	struct EnumValueRecord
+	{
+		StringRef Name;
+		int64 Value;
+	};
+
+	struct OffsetRecord
+	{
+		StringRef Name;
+		int32 Value;
+	};
+}
+
+ENUM_OPERATORS(Snapshot::EEngineFlags);
+
+
+class ReflectionSnapshot
+{
+private:
+	const uint8* Data = nullptr;
+	uint64 DataSize = 0x0;
+
+	/* Platform handles of the mapping, unused when the snapshot was loaded from memory */
+	void* FileHandle = nullptr;
+	void* MappingHandle = nullptr;
+
+public:
+	ReflectionSnapshot() = default;
+	ReflectionSnapshot(const ReflectionSnapshot&) = delete;
+	ReflectionSnapshot(ReflectionSnapshot&& Other) noexcept;
+
+	~ReflectionSnapshot();
+
+	ReflectionSnapshot& operator=(const ReflectionSnapshot&) = delete;
+	ReflectionSnapshot& operator=(ReflectionSnapshot&& Other) noexcept;
+
+public:
+	/* Captures the reflection data of the current process in a single pass over GObjects. Requires Generator::InitInternal() to be called. */
+	static bool Write(const fs::path& FilePath);
+
+public:
+	/* Maps the file read-only, records are accessed directly from the mapping */
+	bool Load(const fs::path& FilePath);
+
+	/* Uses an existing buffer, which has to outlive this snapshot, instead of a file */
+	bool LoadFromMemory(const uint8* Buffer, uint64 BufferSize);
+
+	void Unload();
+
+	/* Copies the captured Settings::Internal flags and Off::InSDK offsets into the current process */
+	void ApplySettingsAndOffsets() const;
+
+private:
+	bool ValidateHeader() const;
+
+	template<typename RecordType>
+	std::span<const RecordType> GetSection(Snapshot::ESection Section) const;
+
+public:
+	inline bool IsLoaded() const { return Data != nullptr; }
+
+	const Snapshot::SnapshotHeader& GetHeader() const;
+
+	std::string_view GetString(Snapshot::StringRef Ref) const;
+
+	std::span<const Snapshot::ObjectRecord> GetObjects() const;
+	std::span<const Snapshot::StructRecord> GetStructs() const;
+	std::span<const Snapshot::PropertyRecord> GetProperties() const;
+	std::span<const Snapshot::EnumRecord> GetEnums() const;
+	std::span<const Snapshot::EnumValueRecord> GetEnumValues() const;
+	std::span<const Snapshot::OffsetRecord> GetOffsets() const;
+
+	/* Returns nullptr for invalid indices and empty GObjects-slots */
+	const Snapshot::ObjectRecord* GetObjectByIndex(int32 Index) const;
+	const Snapshot::StructRecord* GetStruct(const Snapshot::ObjectRecord& Object) const;
+	const Snapshot::EnumRecord* GetEnum(const Snapshot::ObjectRecord& Object) const;
+
+	std::span<const Snapshot::PropertyRecord> GetProperties(const Snapshot::StructRecord& Struct) const;
+	std::span<const Snapshot::PropertyRecord> GetInnerProperties(const Snapshot::PropertyRecord& Property) const;
+	std::span<const Snapshot::EnumValueRecord> GetEnumValues(const Snapshot::EnumRecord& Enum) const;
+};
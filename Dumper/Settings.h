@@ -18,6 +18,24 @@ namespace Settings
 		inline std::string GameVersion = "";
 
 		inline constexpr const char* SDKGenerationPath = "C:/Dumper-7";
+
+		/* Whether to write 'ReflectionSnapshot.bin', containing all reflection data used by the generators, into the game's SDK folder */
+		inline constexpr bool bGenerateReflectionSnapshot = false;
+
+		/* Keeps the previous CppSDK instead of moving it to a '_OLD' folder, its files are only rewritten if their content changed and unchanged files keep their modification time. Other generators still move their folder to '_OLD'. */
+		inline constexpr bool bOnlyWriteChangedFiles = false;
+
+		/* Number of threads used by ObjectArray::ParallelForEach() during initialization. 0 -> std::thread::hardware_concurrency(), 1 -> calling thread only. Split between the initializers running at once with bInitializeManagersConcurrently. */
+		inline constexpr int32 NumObjectArrayThreads = 0;
+
+		/* Runs the independent initializers in Generator::InitInternal() (PackageManager, StructManager, EnumManager, MemberManager) on separate threads */
+		inline constexpr bool bInitializeManagersConcurrently = true;
+
+		/* Runs CppGenerator, MappingGenerator, IDAMappingGenerator and DumpspaceGenerator on separate threads */
+		inline constexpr bool bRunGeneratorsConcurrently = true;
+
+		/* Stores all offsets found in Generator::InitEngineCore() in 'SDKGenerationPath/OffsetCache' and reuses them until the game-binary changes */
+		inline constexpr bool bUseOffsetCache = true;
 	}
 
 	namespace CppGenerator
@@ -56,6 +74,15 @@ R"(
 
 		/* This will allow the user to manually initialize global variable addresses in the SDK (eg. GObjects, GNames, AppendString). */
 		constexpr bool bAddManualOverrideOptions = true;
+
+		/* Number of threads generating package-files in parallel. 0 -> std::thread::hardware_concurrency(), 1 -> generate on the calling thread only. */
+		constexpr int32 NumPackageGenerationThreads = 0;
+
+		/* Whether generated files are written to disk on a separate IO-thread, while generation continues */
+		constexpr bool bWriteFilesAsynchronously = true;
+
+		/* Only regenerates packages whose reflection data changed since the previous run, or which depend on such packages. Requires Settings::Generator::bOnlyWriteChangedFiles. */
+		constexpr bool bOnlyGenerateChangedPackages = false;
 	}
 
 	namespace MappingGenerator
@@ -66,8 +93,17 @@ R"(
 		/* Whether EditorOnly should be excluded from the mapping file. */
 		constexpr bool bExcludeEditorOnlyProperties = true;
 
-		/* Which compression method to use when generating the file. */
-		constexpr EUsmapCompressionMethod CompressionMethod = EUsmapCompressionMethod::ZStandard;
+		/* Which compression method to use when generating the file. Not constexpr, the compression settings can be changed at runtime before the MappingGenerator runs. */
+		inline EUsmapCompressionMethod CompressionMethod = EUsmapCompressionMethod::ZStandard;
+
+		/* zstd compression level, 1 is the fastest, ZSTD_maxCLevel() (22) produces the smallest files but is very slow. */
+		inline int32 CompressionLevel = 19;
+
+		/* Number of zstd worker-threads. 0 -> std::thread::hardware_concurrency(), 1 -> compress on the calling thread only. */
+		inline int32 NumCompressionThreads = 0;
+
+		/* Window size as log2 (eg. 27 -> 128MB) for zstd's long-distance-matching, 0 disables it. Windows above 27 require readers to raise their window limit. */
+		inline int32 LongDistanceMatchingWindowLog = 0;
 	}
 
 	/* Partially implemented  */
@@ -84,6 +120,15 @@ R"(
 
 		/* Prints debug information during Mapping-Generation */
 		inline constexpr bool bShouldPrintMappingDebugData = false;
+
+		/* Prints how many member type-strings CppGenerator built and how many it reused from its PropertyTypeCache */
+		inline constexpr bool bPrintPropertyTypeCacheStats = false;
+
+		/* Compresses the usmap-payload with every zstd level and prints size, ratio and time for each of them */
+		inline constexpr bool bBenchmarkMappingCompression = false;
+
+		/* Prints how long each initializer in Generator::InitInternal() took and which of them were on the critical path */
+		inline constexpr bool bPrintInitTimings = false;
 	}
 
 	//* * * * * * * * * * * * * * * * * * * * *// 
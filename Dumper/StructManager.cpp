@@ -55,16 +55,28 @@ void StructManager::InitAlignmentsAndNames()
 {
 	constexpr int32 DefaultClassAlignment = 0x8;
 
-	for (auto Obj : ObjectArray())
+	struct AlignmentAndName
+	{
+		int32 Index;
+		std::string CppName;
+		bool bIsFunction;
+
+		int32 Alignment;
+		bool bUseExplicitAlignment;
+	};
+
+	/* Reading names and properties is done in parallel, adding names to UniqueNameTable happens in GObjects-order below */
+	const auto Partitions = ObjectArray::ParallelForEach<std::vector<AlignmentAndName>>([](UEObject Obj, std::vector<AlignmentAndName>& OutInfos)
 	{
 		if (!Obj.IsA(EClassCastFlags::Struct) /* || Obj.IsA(EClassCastFlags::Function)*/)
-			continue;
+			return;
 
 		UEStruct ObjAsStruct = Obj.Cast<UEStruct>();
 
-		// Add name to override info
-		StructInfo& NewOrExistingInfo = StructInfoOverrides[Obj.GetIndex()];
-		NewOrExistingInfo.Name = UniqueNameTable.FindOrAdd(Obj.GetCppName(), !Obj.IsA(EClassCastFlags::Function)).first;
+		AlignmentAndName& Info = OutInfos.emplace_back();
+		Info.Index = Obj.GetIndex();
+		Info.CppName = Obj.GetCppName();
+		Info.bIsFunction = Obj.IsA(EClassCastFlags::Function);
 
 		int32 MinAlignment = ObjAsStruct.GetMinAlignment();
 		int32 HighestMemberAlignment = 0x1; // starting at 0x1 when checking **all**, not just struct-properties
@@ -84,13 +96,26 @@ void StructManager::InitAlignmentsAndNames()
 		// if Class alignment is below pointer-alignment (0x8), use pointer-alignment instead, else use whichever, MinAlignment or HighestAlignment, is bigger
 		if (ObjAsStruct.IsA(EClassCastFlags::Class) && bHasSuperClass && HighestMemberAlignment < DefaultClassAlignment)
 		{
-			NewOrExistingInfo.bUseExplicitAlignment = false;
-			NewOrExistingInfo.Alignment = DefaultClassAlignment;
+			Info.bUseExplicitAlignment = false;
+			Info.Alignment = DefaultClassAlignment;
 		}
 		else
 		{
-			NewOrExistingInfo.bUseExplicitAlignment = MinAlignment > HighestMemberAlignment;
-			NewOrExistingInfo.Alignment = max(MinAlignment, HighestMemberAlignment);
+			Info.bUseExplicitAlignment = MinAlignment > HighestMemberAlignment;
+			Info.Alignment = max(MinAlignment, HighestMemberAlignment);
+		}
+	});
+
+	for (const std::vector<AlignmentAndName>& Infos : Partitions)
+	{
+		for (const AlignmentAndName& Info : Infos)
+		{
+			// Add name to override info
+			StructInfo& NewOrExistingInfo = StructInfoOverrides[Info.Index];
+			NewOrExistingInfo.Name = UniqueNameTable.FindOrAdd(Info.CppName, !Info.bIsFunction).first;
+
+			NewOrExistingInfo.bUseExplicitAlignment = Info.bUseExplicitAlignment;
+			NewOrExistingInfo.Alignment = Info.Alignment;
 		}
 	}
 
@@ -135,29 +160,25 @@ void StructManager::InitAlignmentsAndNames()
 
 void StructManager::InitSizesAndIsFinal()
 {
-	for (auto Obj : ObjectArray())
+	struct MemberBounds
 	{
-		if (!Obj.IsA(EClassCastFlags::Struct))
-			continue;
-
-		UEStruct ObjAsStruct = Obj.Cast<UEStruct>();
-
-		StructInfo& NewOrExistingInfo = StructInfoOverrides[Obj.GetIndex()];
-
-		// Initialize struct-size if it wasn't set already
-		if (NewOrExistingInfo.Size > ObjAsStruct.GetStructSize())
-			NewOrExistingInfo.Size = ObjAsStruct.GetStructSize();
+		int32 Index;
 
-		UEStruct Super = ObjAsStruct.GetSuper();
+		int32 LastMemberEnd;
+		int32 LowestOffset;
+	};
 
-		if (NewOrExistingInfo.Size == 0x0 && Super != nullptr)
-			NewOrExistingInfo.Size = Super.GetStructSize();
+	/* Iterating the properties of all structs is done in parallel, sizes are propagated to the supers in GObjects-order below */
+	const auto Partitions = ObjectArray::ParallelForEach<std::vector<MemberBounds>>([](UEObject Obj, std::vector<MemberBounds>& OutBounds)
+	{
+		if (!Obj.IsA(EClassCastFlags::Struct))
+			return;
 
 		int32 LastMemberEnd = 0x0;
 		int32 LowestOffset = INT_MAX;
 
 		// Find member with the lowest offset
-		for (UEProperty Property : ObjAsStruct.GetProperties())
+		for (UEProperty Property : Obj.Cast<UEStruct>().GetProperties())
 		{
 			const int32 PropertyOffset = Property.GetOffset();
 			const int32 PropertySize = Property.GetSize();
@@ -169,46 +190,68 @@ void StructManager::InitSizesAndIsFinal()
 				LastMemberEnd = PropertyOffset + PropertySize;
 		}
 
-		/* No need to check any other structs, as finding the LastMemberEnd only involves this struct */
-		NewOrExistingInfo.LastMemberEnd = LastMemberEnd;
-
-		if (!Super || Obj.IsA(EClassCastFlags::Function))
-			continue;
+		OutBounds.push_back({ Obj.GetIndex(), LastMemberEnd, LowestOffset });
+	});
 
-		/*
-		* Loop all super-structs and set their struct-size to the lowest offset we found. Sets this size on the direct Super and all higher *empty* supers
-		* 
-		* breaks out of the loop after encountering a super-struct which is not empty (aka. has member-variables)
-		*/
-		for (UEStruct S = Super; S; S = S.GetSuper())
+	for (const std::vector<MemberBounds>& Bounds : Partitions)
+	{
+		for (const auto [Index, LastMemberEnd, LowestOffset] : Bounds)
 		{
-			auto It = StructInfoOverrides.find(S.GetIndex());
+			UEObject Obj = ObjectArray::GetByIndex(Index);
+			UEStruct ObjAsStruct = Obj.Cast<UEStruct>();
 
-			if (It == StructInfoOverrides.end())
-			{
-				std::cout << "\n\n\nDumper-7: Error, struct wasn't found in 'StructInfoOverrides'! Exiting...\n\n\n" << std::endl;
-				Sleep(10000);
-				exit(1);
-			}
+			StructInfo& NewOrExistingInfo = StructInfoOverrides[Obj.GetIndex()];
+
+			// Initialize struct-size if it wasn't set already
+			if (NewOrExistingInfo.Size > ObjAsStruct.GetStructSize())
+				NewOrExistingInfo.Size = ObjAsStruct.GetStructSize();
 
-			StructInfo& Info = It->second;
+			UEStruct Super = ObjAsStruct.GetSuper();
 
-			// Struct is not final, as it is another structs' super
-			Info.bIsFinal = false;
+			if (NewOrExistingInfo.Size == 0x0 && Super != nullptr)
+				NewOrExistingInfo.Size = Super.GetStructSize();
 
-			const int32 SizeToCheck = Info.Size == INT_MAX ? S.GetStructSize() : Info.Size;
+			/* No need to check any other structs, as finding the LastMemberEnd only involves this struct */
+			NewOrExistingInfo.LastMemberEnd = LastMemberEnd;
 
-			// Only change lowest offset if it's lower than the already found lowest offset (by default: struct-size)
-			if (Align(SizeToCheck, Info.Alignment) > LowestOffset)
+			if (!Super || Obj.IsA(EClassCastFlags::Function))
+				continue;
+
+			/*
+			* Loop all super-structs and set their struct-size to the lowest offset we found. Sets this size on the direct Super and all higher *empty* supers
+			* 
+			* breaks out of the loop after encountering a super-struct which is not empty (aka. has member-variables)
+			*/
+			for (UEStruct S = Super; S; S = S.GetSuper())
 			{
-				if (Info.Size > LowestOffset)
-					Info.Size = LowestOffset;
+				auto It = StructInfoOverrides.find(S.GetIndex());
 
-				Info.bHasReusedTrailingPadding = true;
-			}
+				if (It == StructInfoOverrides.end())
+				{
+					std::cout << "\n\n\nDumper-7: Error, struct wasn't found in 'StructInfoOverrides'! Exiting...\n\n\n" << std::endl;
+					Sleep(10000);
+					exit(1);
+				}
+
+				StructInfo& Info = It->second;
+
+				// Struct is not final, as it is another structs' super
+				Info.bIsFinal = false;
 
-			if (S.HasMembers())
-				break;
+				const int32 SizeToCheck = Info.Size == INT_MAX ? S.GetStructSize() : Info.Size;
+
+				// Only change lowest offset if it's lower than the already found lowest offset (by default: struct-size)
+				if (Align(SizeToCheck, Info.Alignment) > LowestOffset)
+				{
+					if (Info.Size > LowestOffset)
+						Info.Size = LowestOffset;
+
+					Info.bHasReusedTrailingPadding = true;
+				}
+
+				if (S.HasMembers())
+					break;
+			}
 		}
 	}
 }
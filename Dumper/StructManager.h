@@ -2,6 +2,7 @@
 #include <unordered_map>
 #include <unordered_set>
 #include "HashStringTable.h"
+#include "IndexedInfoMap.h"
 #include "UnrealObjects.h"
 #include "ObjectArray.h" /* for debug print */
 
@@ -79,14 +80,14 @@ private:
 	friend class StructManagerTest;
 
 public:
-	using OverrideMaptType = std::unordered_map<int32 /*StructIdx*/, StructInfo>;
+	using OverrideMaptType = IndexedInfoMap<StructInfo>;
 	using CycleInfoListType = std::unordered_map<int32 /*StructIdx*/, std::unordered_set<int32 /* Packages cyclic with this structs' package */>>;
 
 private:
 	/* NameTable containing names of all structs/classes as well as information on name-collisions */
 	static inline HashStringTable UniqueNameTable;
 
-	/* Map containing infos on all structs/classes. Implemented due to bugs/inconsistencies in Unreal's reflection system */
+	/* Infos on all structs/classes, indexed by the structs' GObjects-index. Implemented due to bugs/inconsistencies in Unreal's reflection system */
 	static inline OverrideMaptType StructInfoOverrides;
 
 	/* Map containing infos on all structs/classes that are within a packages that has cyclic dependencies */
@@ -5,6 +5,9 @@
 
 #include <utility>
 #include <array>
+#include <vector>
+#include <map>
+#include <type_traits>
 
 // Tables taken from the llvm-project repository on github
 // LLVMs license: https://llvm.org/LICENSE.txt
@@ -18,6 +21,11 @@ public:
     friend constexpr bool IsUnicodeCharXIDContinue(char32_t Character);
     friend constexpr bool IsUnicodeCharXIDContinueWithoutXIDStart(char32_t Character);
 
+    /* Built from the ranges, its lookups are equivalent to the accessor functions */
+    friend class UnicodeXIDBitmap;
+
+    friend class UnicodeNamesTest;
+
 private:
     using UnicodeCharRange = std::pair<char32_t, char32_t>;
 
@@ -401,16 +409,128 @@ constexpr UnicodeRangeTable XIDContinueRanges = {{
     { 0x1E950, 0x1E959 }, { 0x1FBF0, 0x1FBF9 }, { 0xE0100, 0xE01EF },
 }};
 
+/*
+* Two-level bitmap of XID_Start and XID_Continue, built from the range-tables once on first use. Replaces the binary-search at runtime.
+*
+* Code points are split into blocks of 256. The first level maps every block to a unique 256-bit block, most blocks are completely
+* empty or completely set and share the same bits. Both properties together take about 24KB.
+*/
+class UnicodeXIDBitmap
+{
+private:
+    static constexpr uint32_t NumCodePoints = 0x110000;
+
+    static constexpr uint32_t BlockSizeBits = 8;
+    static constexpr uint32_t BlockSize = 1 << BlockSizeBits;
+    static constexpr uint32_t NumBlocks = NumCodePoints / BlockSize;
+
+    using BitBlock = std::array<uint64_t, BlockSize / 64>;
+    using BlockIndexTable = std::array<uint16_t, NumBlocks>;
+
+private:
+    BlockIndexTable StartBlockIndices;
+    BlockIndexTable ContinueBlockIndices;
+
+    std::vector<BitBlock> UniqueBlocks;
+
+private:
+    UnicodeXIDBitmap()
+    {
+        std::vector<BitBlock> StartBlocks(NumBlocks, BitBlock{});
+        std::vector<BitBlock> ContinueBlocks(NumBlocks, BitBlock{});
+
+        auto AddRanges = [](std::vector<BitBlock>& Blocks, const auto& Ranges) -> void
+        {
+            for (const auto& [First, Last] : Ranges.CharRanges)
+            {
+                for (uint32_t CodePoint = First; CodePoint <= Last; CodePoint++)
+                    Blocks[CodePoint >> BlockSizeBits][(CodePoint & (BlockSize - 1)) >> 6] |= 1ull << (CodePoint & 63);
+            }
+        };
+
+        /* XID_Continue is a super set of XID_Start, see 'XIDContinueRanges' */
+        AddRanges(StartBlocks, XIDStartRanges);
+        AddRanges(ContinueBlocks, XIDStartRanges);
+        AddRanges(ContinueBlocks, XIDContinueRanges);
+
+        std::map<BitBlock, uint16_t> BlockToUniqueIndex;
+
+        auto Deduplicate = [this, &BlockToUniqueIndex](const std::vector<BitBlock>& Blocks, BlockIndexTable& OutIndices) -> void
+        {
+            for (uint32_t i = 0; i < NumBlocks; i++)
+            {
+                auto [It, bWasInserted] = BlockToUniqueIndex.try_emplace(Blocks[i], static_cast<uint16_t>(UniqueBlocks.size()));
+
+                if (bWasInserted)
+                    UniqueBlocks.push_back(Blocks[i]);
+
+                OutIndices[i] = It->second;
+            }
+        };
+
+        Deduplicate(StartBlocks, StartBlockIndices);
+        Deduplicate(ContinueBlocks, ContinueBlockIndices);
+    }
+
+private:
+    inline bool Contains(const BlockIndexTable& BlockIndices, char32_t Character) const
+    {
+        if (Character >= NumCodePoints)
+            return false;
+
+        const BitBlock& Block = UniqueBlocks[BlockIndices[Character >> BlockSizeBits]];
+
+        return (Block[(Character & (BlockSize - 1)) >> 6] >> (Character & 63)) & 1;
+    }
+
+public:
+    static inline const UnicodeXIDBitmap& Get()
+    {
+        static const UnicodeXIDBitmap Bitmap;
+
+        return Bitmap;
+    }
+
+public:
+    inline bool IsXIDStart(char32_t Character) const { return Contains(StartBlockIndices, Character); }
+    inline bool IsXIDContinue(char32_t Character) const { return Contains(ContinueBlockIndices, Character); }
+
+    inline size_t GetNumUniqueBlocks() const { return UniqueBlocks.size(); }
+};
+
+/* ASCII characters are checked directly, without touching the bitmap */
+constexpr inline bool IsAsciiCharXIDStart(char32_t Character)
+{
+    return (Character | 0x20) >= 'a' && (Character | 0x20) <= 'z';
+}
+
+constexpr inline bool IsAsciiCharXIDContinue(char32_t Character)
+{
+    return IsAsciiCharXIDStart(Character) || (Character >= '0' && Character <= '9') || Character == '_';
+}
+
 /* Checks a character for the XID_Start property. XID_Start -> valid start character for a C++ name. */
 constexpr inline bool IsUnicodeCharXIDStart(char32_t Character)
 {
-    return XIDStartRanges.Contains(Character);
+    if (std::is_constant_evaluated())
+        return XIDStartRanges.Contains(Character);
+
+    if (Character < 0x80) [[likely]]
+        return IsAsciiCharXIDStart(Character);
+
+    return UnicodeXIDBitmap::Get().IsXIDStart(Character);
 }
 
 /* Checks a character for the XID_Continue property.  XID_Continue -> valid followup (2nd or later) character for a C++ name. */
 constexpr bool IsUnicodeCharXIDContinue(char32_t Character)
 {
-    return XIDStartRanges.Contains(Character) || XIDContinueRanges.Contains(Character);
+    if (std::is_constant_evaluated())
+        return XIDStartRanges.Contains(Character) || XIDContinueRanges.Contains(Character);
+
+    if (Character < 0x80) [[likely]]
+        return IsAsciiCharXIDContinue(Character);
+
+    return UnicodeXIDBitmap::Get().IsXIDContinue(Character);
 }
 /* Checks if a character has XID_Continue, but not XID_Start. */
 constexpr bool IsUnicodeCharXIDContinueWithoutXIDStart(char32_t Character)
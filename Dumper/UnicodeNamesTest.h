@@ -0,0 +1,135 @@
+#pragma once
+#include <chrono>
+#include "UnrealTypes.h"
+#include "NameArray.h"
+#include "UnicodeNames.h"
+#include "TestBase.h"
+
+class UnicodeNamesTest : protected TestBase
+{
+private:
+	/* The previous implementation of MakeNameValid, using the binary-search over the range-tables for every character */
+	static inline std::string MakeNameValidReference(std::wstring Name)
+	{
+		static constexpr const wchar_t* Numbers[10] = { L"Zero", L"One", L"Two", L"Three", L"Four", L"Five", L"Six", L"Seven", L"Eight", L"Nine" };
+
+		if (Name == L"bool")
+			return "Bool";
+
+		if (Name == L"NULL")
+			return "NULLL";
+
+		if (Name[0] <= '9' && Name[0] >= '0')
+			Name.replace(0, 1, Numbers[Name[0] - '0']);
+
+		std::u32string Utf32Name = UtfN::Utf16StringToUtf32String<std::u32string>(Name);
+
+		for (auto It = UtfN::utf32_iterator<std::u32string::iterator>(Utf32Name); It; ++It)
+		{
+			if (!XIDStartRanges.Contains((*It).Get()) && !XIDContinueRanges.Contains((*It).Get()))
+				It.Replace('_');
+		}
+
+		return UtfN::Utf32StringToUtf8String<std::string>(Utf32Name);
+	}
+
+public:
+	template<bool bDoDebugPrinting = false>
+	static inline void TestAll()
+	{
+		TestBitmap<bDoDebugPrinting>();
+		TestMakeNameValid<bDoDebugPrinting>();
+		TestMakeNameValidSpeed<bDoDebugPrinting>();
+
+		PrintDbgMessage<bDoDebugPrinting>("");
+	}
+
+	template<bool bDoDebugPrinting = false>
+	static inline void TestBitmap()
+	{
+		bool bSuccededTestWithoutError = true;
+
+		for (char32_t Character = 0x0; Character < 0x110000; Character++)
+		{
+			const bool bIsStart = XIDStartRanges.Contains(Character);
+			const bool bIsContinue = bIsStart || XIDContinueRanges.Contains(Character);
+
+			if (IsUnicodeCharXIDStart(Character) == bIsStart && IsUnicodeCharXIDContinue(Character) == bIsContinue)
+				continue;
+
+			PrintDbgMessage<bDoDebugPrinting>("{} --> Mismatch for U+{:04X}", __FUNCTION__, static_cast<uint32>(Character));
+			bSuccededTestWithoutError = false;
+		}
+
+		PrintDbgMessage<bDoDebugPrinting>("{} --> Unique blocks: {}", __FUNCTION__, UnicodeXIDBitmap::Get().GetNumUniqueBlocks());
+		std::cout << __FUNCTION__ << ": " << (bSuccededTestWithoutError ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
+	template<bool bDoDebugPrinting = false>
+	static inline void TestMakeNameValid()
+	{
+		const std::wstring Names[] =
+		{
+			L"bool", L"NULL", L"", L"0", L"7Days", L"_Underscore", L"Some Name-With.Dots", L"AlreadyValid_Name123",
+			L"Nam\u00E9", L"\u00DCberName", L"Name\U0001F600", L"\u0301Combining", L"VeryLongAlreadyValidNameWithMoreThanEightCharacters",
+		};
+
+		bool bSuccededTestWithoutError = true;
+
+		for (const std::wstring& Name : Names)
+		{
+			const std::string Result = MakeNameValid(Name);
+			const std::string Expected = MakeNameValidReference(Name);
+
+			if (Result == Expected)
+				continue;
+
+			PrintDbgMessage<bDoDebugPrinting>("{} --> \"{}\" != \"{}\"", __FUNCTION__, Result, Expected);
+			bSuccededTestWithoutError = false;
+		}
+
+		std::cout << __FUNCTION__ << ": " << (bSuccededTestWithoutError ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
+	/* Compares MakeNameValid to the previous implementation over every name in GNames */
+	template<bool bDoDebugPrinting = false>
+	static inline void TestMakeNameValidSpeed()
+	{
+		DecodedNameTable Names;
+
+		if (!NameArray::DecodeAllNames(Names))
+		{
+			std::cout << __FUNCTION__ << ": " << "SKIPPED, names can't be decoded from GNames!" << std::endl;
+			return;
+		}
+
+		std::vector<std::wstring> WideNames;
+		WideNames.reserve(Names.Num());
+
+		for (int32 i = 0; i < Names.Num(); i++)
+			WideNames.push_back(UtfN::StringToWString(std::string(Names.GetName(i))));
+
+		auto TimeMakeNameValid = [&WideNames](auto&& MakeValid, std::vector<std::string>& OutNames) -> double
+		{
+			OutNames.reserve(WideNames.size());
+
+			const auto StartTime = std::chrono::high_resolution_clock::now();
+
+			for (const std::wstring& Name : WideNames)
+				OutNames.push_back(Name.empty() ? std::string() : MakeValid(Name));
+
+			return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - StartTime).count();
+		};
+
+		std::vector<std::string> ReferenceNames;
+		std::vector<std::string> ValidNames;
+
+		const double ReferenceMs = TimeMakeNameValid([](const std::wstring& Name) { return MakeNameValidReference(Name); }, ReferenceNames);
+		const double ValidMs = TimeMakeNameValid([](const std::wstring& Name) { return MakeNameValid(Name); }, ValidNames);
+
+		const bool bSuccededTestWithoutError = ReferenceNames == ValidNames;
+
+		PrintDbgMessage<bDoDebugPrinting>("{} --> 0x{:X} names, reference: {:.2f}ms, MakeNameValid: {:.2f}ms", __FUNCTION__, WideNames.size(), ReferenceMs, ValidMs);
+		std::cout << __FUNCTION__ << ": " << (bSuccededTestWithoutError ? "SUCCEEDED!" : "FAILED!") << std::format(" ({:.2f}x faster)", ReferenceMs / ValidMs) << std::endl;
+	}
+};
@@ -1,4 +1,5 @@
 #include <format>
+#include <mutex>
 
 #include "UnrealObjects.h"
 #include "Offsets.h"
@@ -150,28 +151,46 @@ std::string UEFField::GetValidName() const
 	return Field ? GetFName().ToValidString() : "None";
 }
 
+std::string_view UEFField::GetNameView() const
+{
+	return Field ? GetFName().ToStringView() : "None";
+}
+
+std::string_view UEFField::GetValidNameView() const
+{
+	return Field ? GetFName().ToValidStringView() : "None";
+}
+
 std::string UEFField::GetCppName() const
 {
 	static UEClass ActorClass = ObjectArray::FindClassFast("Actor");
 	static UEClass InterfaceClass = ObjectArray::FindClassFast("Interface");
 
-	std::string Temp = GetValidName();
+	const std::string_view Temp = GetValidNameView();
+
+	auto WithPrefix = [Temp](char Prefix) -> std::string
+	{
+		std::string CppName(1, Prefix);
+		CppName += Temp;
+
+		return CppName;
+	};
 
 	if (IsA(EClassCastFlags::Class))
 	{
 		if (Cast<UEClass>().HasType(ActorClass))
 		{
-			return 'A' + Temp;
+			return WithPrefix('A');
 		}
 		else if (Cast<UEClass>().HasType(InterfaceClass))
 		{
-			return 'I' + Temp;
+			return WithPrefix('I');
 		}
 
-		return 'U' + Temp;
+		return WithPrefix('U');
 	}
 
-	return 'F' + Temp;
+	return WithPrefix('F');
 }
 
 UEFField::operator bool() const
@@ -243,16 +262,7 @@ bool UEObject::IsA(EClassCastFlags TypeFlags) const
 
 bool UEObject::IsA(UEClass Class) const
 {
-	if (!Class)
-		return false;
-
-	for (UEClass Clss = GetClass(); Clss; Clss = Clss.GetSuper().Cast<UEClass>())
-	{
-		if (Clss == Class)
-			return true;
-	}
-
-	return false;
+	return ObjectArray::IsSubclassOf(GetClass(), Class);
 }
 
 UEObject UEObject::GetOutermost() const
@@ -287,10 +297,21 @@ std::string UEObject::GetValidName() const
 	return Object ? GetFName().ToValidString() : "None";
 }
 
+std::string_view UEObject::GetNameView() const
+{
+	return Object ? GetFName().ToStringView() : "None";
+}
+
+std::string_view UEObject::GetValidNameView() const
+{
+	return Object ? GetFName().ToValidStringView() : "None";
+}
+
 std::string UEObject::GetCppName() const
 {
-	static UEClass ActorClass = nullptr;
-	static UEClass InterfaceClass = nullptr;
+	/* GetCppName is called from ObjectArray::ParallelForEach */
+	thread_local UEClass ActorClass = nullptr;
+	thread_local UEClass InterfaceClass = nullptr;
 
 	if (ActorClass == nullptr)
 		ActorClass = ObjectArray::FindClassFast("Actor");
@@ -298,23 +319,31 @@ std::string UEObject::GetCppName() const
 	if (InterfaceClass == nullptr)
 		InterfaceClass = ObjectArray::FindClassFast("Interface");
 
-	std::string Temp = GetValidName();
+	const std::string_view Temp = GetValidNameView();
+
+	auto WithPrefix = [Temp](char Prefix) -> std::string
+	{
+		std::string CppName(1, Prefix);
+		CppName += Temp;
+
+		return CppName;
+	};
 
 	if (IsA(EClassCastFlags::Class))
 	{
 		if (Cast<UEClass>().HasType(ActorClass))
 		{
-			return 'A' + Temp;
+			return WithPrefix('A');
 		}
 		else if (Cast<UEClass>().HasType(InterfaceClass))
 		{
-			return 'I' + Temp;
+			return WithPrefix('I');
 		}
 
-		return 'U' + Temp;
+		return WithPrefix('U');
 	}
 
-	return 'F' + Temp;
+	return WithPrefix('F');
 }
 
 std::string UEObject::GetFullName(int32& OutNameLength) const
@@ -325,15 +354,19 @@ std::string UEObject::GetFullName(int32& OutNameLength) const
 
 		for (UEObject Outer = GetOuter(); Outer; Outer = Outer.GetOuter())
 		{
-			Temp = Outer.GetName() + '.' + Temp;
+			Temp.insert(0, 1, '.');
+			Temp.insert(0, Outer.GetNameView());
 		}
 
-		std::string Name = GetName();
+		const std::string_view Name = GetNameView();
 		OutNameLength = Name.size() + 1;
 
-		Name = GetClass().GetName() + ' ' + Temp + Name;
+		std::string FullName(GetClass().GetNameView());
+		FullName += ' ';
+		FullName += Temp;
+		FullName += Name;
 
-		return Name;
+		return FullName;
 	}
 
 	return "None";
@@ -347,13 +380,14 @@ std::string UEObject::GetFullName() const
 
 		for (UEObject Outer = GetOuter(); Outer; Outer = Outer.GetOuter())
 		{
-			Temp = Outer.GetName() + "." + Temp;
+			Temp.insert(0, 1, '.');
+			Temp.insert(0, Outer.GetNameView());
 		}
 
-		std::string Name = GetClass().GetName();
+		std::string Name(GetClass().GetNameView());
 		Name += " ";
 		Name += Temp;
-		Name += GetName();
+		Name += GetNameView();
 
 		return Name;
 	}
@@ -586,7 +620,7 @@ UEProperty UEStruct::FindMember(const std::string& MemberName, EClassCastFlags T
 	{
 		for (UEFField Field = GetChildProperties(); Field; Field = Field.GetNext())
 		{
-			if (Field.IsA(TypeFlags) && Field.GetName() == MemberName)
+			if (Field.IsA(TypeFlags) && Field.GetNameView() == MemberName)
 			{
 				return Field.Cast<UEProperty>();
 			}
@@ -595,7 +629,7 @@ UEProperty UEStruct::FindMember(const std::string& MemberName, EClassCastFlags T
 
 	for (UEField Field = GetChild(); Field; Field = Field.GetNext())
 	{
-		if (Field.IsA(TypeFlags) && Field.GetName() == MemberName)
+		if (Field.IsA(TypeFlags) && Field.GetNameView() == MemberName)
 		{
 			return Field.Cast<UEProperty>();
 		}
@@ -646,16 +680,7 @@ bool UEClass::IsType(EClassCastFlags TypeFlag) const
 
 bool UEClass::HasType(UEClass TypeClass) const
 {
-	if (TypeClass == nullptr)
-		return false;
-
-	for (UEStruct S = *this; S; S = S.GetSuper())
-	{
-		if (S == TypeClass)
-			return true;
-	}
-
-	return false;
+	return ObjectArray::IsSubclassOf(*this, TypeClass);
 }
 
 UEObject UEClass::GetDefaultObject() const
@@ -667,12 +692,12 @@ UEFunction UEClass::GetFunction(const std::string& ClassName, const std::string&
 {
 	for (UEStruct Struct = *this; Struct; Struct = Struct.GetSuper())
 	{
-		if (Struct.GetName() != ClassName)
+		if (Struct.GetNameView() != ClassName)
 			continue;
 
 		for (UEField Field = Struct.GetChild(); Field; Field = Field.GetNext())
 		{
-			if (Field.IsA(EClassCastFlags::Function) && Field.GetName() == FuncName)
+			if (Field.IsA(EClassCastFlags::Function) && Field.GetNameView() == FuncName)
 			{
 				return Field.Cast<UEFunction>();
 			}
@@ -806,6 +831,16 @@ std::string UEProperty::GetValidName() const
 	return Base ? GetFName().ToValidString() : "None";
 }
 
+std::string_view UEProperty::GetNameView() const
+{
+	return Base ? GetFName().ToStringView() : "None";
+}
+
+std::string_view UEProperty::GetValidNameView() const
+{
+	return Base ? GetFName().ToValidStringView() : "None";
+}
+
 int32 UEProperty::GetAlignment() const
 {
 	EClassCastFlags TypeFlags = (GetClass().first ? GetClass().first.GetCastFlags() : GetClass().second.GetCastFlags());
@@ -947,6 +982,9 @@ int32 UEProperty::GetAlignment() const
 	{
 		static std::unordered_map<void*, int32> UnknownProperties;
 
+		/* Recursive, as the lookup calls GetAlignment() on other properties. Packages are generated on multiple threads. */
+		static std::recursive_mutex UnknownPropertiesMutex;
+
 		static auto TryFindPropertyRefInOptionalToGetAlignment = [](std::unordered_map<void*, int32>& OutProperties, void* PropertyClass) -> int32
 		{
 			/* Search for a TOptionalProperty that contains an instance of this property */
@@ -971,6 +1009,8 @@ int32 UEProperty::GetAlignment() const
 			return OutProperties.insert({ PropertyClass, 0x1 }).first->second;
 		};
 
+		std::scoped_lock Lock(UnknownPropertiesMutex);
+
 		auto It = UnknownProperties.find(GetClass().second.GetAddress());
 
 		/* Safe to use first member, as we're guaranteed to use FProperty */
@@ -86,6 +86,10 @@ public:
 	std::string GetValidName() const;
 	std::string GetCppName() const;
 
+	/* Views into the FNameStringCache, no string is built */
+	std::string_view GetNameView() const;
+	std::string_view GetValidNameView() const;
+
 	explicit operator bool() const;
 	bool operator==(const UEFField& Other) const;
 	bool operator!=(const UEFField& Other) const;
@@ -134,6 +138,11 @@ public:
 	std::string GetNameWithPath() const;
 	std::string GetValidName() const;
 	std::string GetCppName() const;
+
+	/* Views into the FNameStringCache, no string is built */
+	std::string_view GetNameView() const;
+	std::string_view GetValidNameView() const;
+
 	std::string GetFullName(int32& OutNameLength) const;
 	std::string GetFullName() const;
 	std::string GetPathName() const;
@@ -266,6 +275,10 @@ public:
 	std::string GetName() const;
 	std::string GetValidName() const;
 
+	/* Views into the FNameStringCache, no string is built */
+	std::string_view GetNameView() const;
+	std::string_view GetValidNameView() const;
+
 	std::string GetCppType() const;
 
 	std::string GetPropClassName() const;
@@ -1,24 +1,63 @@
 #include <format>
+#include <emmintrin.h>
 
 #include "UnrealTypes.h"
 #include "NameArray.h"
 
 #include "UnicodeNames.h"
 
-std::string MakeNameValid(std::wstring&& Name)
+/* True if all characters are ASCII letters, digits or '_'. Checks 8 UTF-16 characters at once. */
+static bool IsValidAsciiIdentifier(std::wstring_view Name)
 {
-	static constexpr const wchar_t* Numbers[10] =
+	size_t i = 0;
+
+	if constexpr (sizeof(wchar_t) == 0x2)
+	{
+		/* Characters >= 0x8000 are negative in the signed 16bit comparisons and are never in any of the ranges */
+		const __m128i LowercaseBit = _mm_set1_epi16(0x20);
+		const __m128i BeforeLowerA = _mm_set1_epi16('a' - 1);
+		const __m128i AfterLowerZ = _mm_set1_epi16('z' + 1);
+		const __m128i BeforeZero = _mm_set1_epi16('0' - 1);
+		const __m128i AfterNine = _mm_set1_epi16('9' + 1);
+		const __m128i Underscore = _mm_set1_epi16('_');
+
+		for (; i + 8 <= Name.size(); i += 8)
+		{
+			const __m128i Chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Name.data() + i));
+			const __m128i LowerChars = _mm_or_si128(Chars, LowercaseBit);
+
+			const __m128i IsLetter = _mm_and_si128(_mm_cmpgt_epi16(LowerChars, BeforeLowerA), _mm_cmplt_epi16(LowerChars, AfterLowerZ));
+			const __m128i IsDigit = _mm_and_si128(_mm_cmpgt_epi16(Chars, BeforeZero), _mm_cmplt_epi16(Chars, AfterNine));
+			const __m128i IsUnderscore = _mm_cmpeq_epi16(Chars, Underscore);
+
+			if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(IsLetter, IsDigit), IsUnderscore)) != 0xFFFF)
+				return false;
+		}
+	}
+
+	for (; i < Name.size(); i++)
+	{
+		if (!IsAsciiCharXIDContinue(Name[i]))
+			return false;
+	}
+
+	return true;
+}
+
+std::string MakeNameValid(std::wstring_view Name)
+{
+	static constexpr const char* Numbers[10] =
 	{
-		L"Zero",
-		L"One",
-		L"Two",
-		L"Three",
-		L"Four",
-		L"Five",
-		L"Six",
-		L"Seven",
-		L"Eight",
-		L"Nine"
+		"Zero",
+		"One",
+		"Two",
+		"Three",
+		"Four",
+		"Five",
+		"Six",
+		"Seven",
+		"Eight",
+		"Nine"
 	};
 
 	if (Name == L"bool")
@@ -27,33 +66,38 @@ std::string MakeNameValid(std::wstring&& Name)
 	if (Name == L"NULL")
 		return "NULLL";
 
+	if (Name.empty())
+		return "";
+
+	std::string ValidName;
+
 	/* Replace 0 with Zero or 9 with Nine, if it is the first letter of the name. */
 	if (Name[0] <= '9' && Name[0] >= '0')
 	{
-		Name.replace(0, 1, Numbers[Name[0] - '0']);
+		ValidName = Numbers[Name[0] - '0'];
+		Name.remove_prefix(1);
+	}
+
+	/* Almost all names are plain ASCII identifiers already and only need to be narrowed */
+	if (IsValidAsciiIdentifier(Name)) [[likely]]
+	{
+		ValidName.reserve(ValidName.size() + Name.size());
+
+		for (const wchar_t C : Name)
+			ValidName.push_back(static_cast<char>(C));
+
+		return ValidName;
 	}
-	
-	std::u32string Strrr;
-	Strrr += UtfN::utf_cp32_t{ 200 };
 
 	std::u32string Utf32Name = UtfN::Utf16StringToUtf32String<std::u32string>(Name);
 
-	bool bIsFirstIteration = true;
 	for (auto It = UtfN::utf32_iterator<std::u32string::iterator>(Utf32Name); It; ++It)
 	{
-		if (bIsFirstIteration && !IsUnicodeCharXIDStart(Name[0]))
-		{
-			/* Replace invalid starting character with 'm' character. 'm' for "member" */
-			Name[0] = 'm';
-
-			bIsFirstIteration = false;
-		}
-
 		if (!IsUnicodeCharXIDContinue((*It).Get()))
 			It.Replace('_');
 	}
 
-	return  UtfN::Utf32StringToUtf8String<std::string>(Utf32Name);;
+	return ValidName + UtfN::Utf32StringToUtf8String<std::string>(Utf32Name);
 }
 
 
@@ -228,6 +272,9 @@ std::string FName::ToRawString() const
 	if (!Address)
 		return "None";
 
+	if (FNameStringCache::IsEnabled())
+		return std::string(FNameStringCache::FindOrAdd(GetCompIdx(), GetNumber()).Raw);
+
 	return UtfN::WStringToString(ToRawWString());
 }
 
@@ -236,14 +283,50 @@ std::string FName::ToString() const
 	if (!Address)
 		return "None";
 
+	if (FNameStringCache::IsEnabled())
+		return std::string(FNameStringCache::FindOrAdd(GetCompIdx(), GetNumber()).Short);
+
 	return UtfN::WStringToString(ToWString());
 }
 
 std::string FName::ToValidString() const
 {
+	if (Address && FNameStringCache::IsEnabled())
+		return std::string(FNameStringCache::FindOrAdd(GetCompIdx(), GetNumber()).Valid);
+
 	return MakeNameValid(ToWString());
 }
 
+std::string_view FName::ToRawStringView() const
+{
+	if (!Address)
+		return "None";
+
+	if (FNameStringCache::IsEnabled())
+		return FNameStringCache::FindOrAdd(GetCompIdx(), GetNumber()).Raw;
+
+	return FNameStringCache::Intern(ToRawString());
+}
+
+std::string_view FName::ToStringView() const
+{
+	if (!Address)
+		return "None";
+
+	if (FNameStringCache::IsEnabled())
+		return FNameStringCache::FindOrAdd(GetCompIdx(), GetNumber()).Short;
+
+	return FNameStringCache::Intern(ToString());
+}
+
+std::string_view FName::ToValidStringView() const
+{
+	if (Address && FNameStringCache::IsEnabled())
+		return FNameStringCache::FindOrAdd(GetCompIdx(), GetNumber()).Valid;
+
+	return FNameStringCache::Intern(ToValidString());
+}
+
 int32 FName::GetCompIdx() const 
 {
 	return *reinterpret_cast<const int32*>(Address + Off::FName::CompIdx);
@@ -298,3 +381,210 @@ void* FName::DEBUGGetAppendString()
 {
 	return (void*)(AppendString);
 }
+
+
+std::unique_ptr<DecodedNameTable> FNameStringCache::DecodedNames;
+std::vector<std::unique_ptr<DecodedNameTable>> FNameStringCache::RetiredDecodedNames;
+
+/* Converts to UTF-16 for MakeNameValid, ascii names are widened char by char */
+static std::string MakeUtf8NameValid(std::string_view Name)
+{
+	for (const char C : Name)
+	{
+		if (static_cast<uint8>(C) >= 0x80)
+			return MakeNameValid(UtfN::StringToWString(std::string(Name)));
+	}
+
+	return MakeNameValid(std::wstring(Name.begin(), Name.end()));
+}
+
+void FNameStringCache::Init()
+{
+	std::unique_lock Lock(CacheMutex);
+
+	Pages.clear();
+	NumberedEntries.clear();
+	InternedStrings.clear();
+
+	/* The cleared entries and interned strings pointed into these, but views of them might still be held by the caller */
+	RetiredArenaBlocks.insert(RetiredArenaBlocks.end(), std::make_move_iterator(ArenaBlocks.begin()), std::make_move_iterator(ArenaBlocks.end()));
+	ArenaBlocks.clear();
+	CurrentArenaBlockOffset = ArenaBlockSize;
+
+	if (DecodedNames)
+		RetiredDecodedNames.push_back(std::move(DecodedNames));
+
+	DecodedNames = std::make_unique<DecodedNameTable>();
+
+	/* With case-preserving names the string depends on the DisplayIndex, which isn't part of the key */
+	bIsEnabled = !Settings::Internal::bUseCasePreservingName;
+
+	/* Decoded names are only identical to the resolved ones if FName::ToString resolves names through GNames as well */
+	bHasDecodedNames = bIsEnabled && Off::InSDK::Name::AppendNameToString == 0x0 && NameArray::DecodeAllNames(*DecodedNames);
+}
+
+std::string_view FNameStringCache::AddToArena(const std::string& Str)
+{
+	if (Str.empty())
+		return std::string_view("", 0);
+
+	/* Oversized strings get a block of their own, the next string starts a new block */
+	if (Str.size() > ArenaBlockSize)
+	{
+		char* OversizedBlock = ArenaBlocks.emplace_back(std::make_unique<char[]>(Str.size())).get();
+		memcpy(OversizedBlock, Str.data(), Str.size());
+
+		CurrentArenaBlockOffset = ArenaBlockSize;
+
+		return std::string_view(OversizedBlock, Str.size());
+	}
+
+	if ((CurrentArenaBlockOffset + Str.size()) > ArenaBlockSize)
+	{
+		ArenaBlocks.push_back(std::make_unique<char[]>(ArenaBlockSize));
+		CurrentArenaBlockOffset = 0x0;
+	}
+
+	char* Target = ArenaBlocks.back().get() + CurrentArenaBlockOffset;
+	memcpy(Target, Str.data(), Str.size());
+
+	CurrentArenaBlockOffset += static_cast<int32>(Str.size());
+
+	return std::string_view(Target, Str.size());
+}
+
+const FNameStringCache::Entry* FNameStringCache::FindUnlocked(int32 CompIdx)
+{
+	const uint32 PageIdx = static_cast<uint32>(CompIdx) >> EntriesPerPageBits;
+
+	if (PageIdx >= Pages.size() || !Pages[PageIdx])
+		return nullptr;
+
+	const Entry& CachedEntry = Pages[PageIdx][CompIdx & (EntriesPerPage - 1)];
+
+	return CachedEntry.Raw.data() ? &CachedEntry : nullptr;
+}
+
+const FNameStringCache::Entry& FNameStringCache::FindOrAdd(int32 CompIdx)
+{
+	{
+		std::shared_lock Lock(CacheMutex);
+
+		if (const Entry* CachedEntry = FindUnlocked(CompIdx))
+			return *CachedEntry;
+	}
+
+	/* Names of the DecodedNames table are already UTF-8 and don't need to be copied, others are resolved for a Number of 0 */
+	const int32 DecodedIndex = bHasDecodedNames ? DecodedNames->Find(CompIdx) : -1;
+
+	std::string RawUtf8;
+	std::string ValidUtf8;
+
+	if (DecodedIndex != -1)
+	{
+		const std::string_view DecodedName = DecodedNames->GetName(DecodedIndex);
+		const size_t SlashPos = DecodedName.rfind('/');
+
+		ValidUtf8 = MakeUtf8NameValid(SlashPos == std::string_view::npos ? DecodedName : DecodedName.substr(SlashPos + 1));
+	}
+	else
+	{
+		/* FName::AppendString reads a whole FName, which is larger with case-preserving names or outline-numbers. Zeroed, so the Number is 0. */
+		const int32 MinFakeNameSize = Off::FName::CompIdx + static_cast<int32>(sizeof(int32));
+		const int32 FakeNameSize = Off::InSDK::Name::FNameSize > MinFakeNameSize ? Off::InSDK::Name::FNameSize : MinFakeNameSize;
+
+		std::vector<uint64> FakeName((FakeNameSize + sizeof(uint64) - 1) / sizeof(uint64), 0x0);
+		*reinterpret_cast<int32*>(reinterpret_cast<uint8*>(FakeName.data()) + Off::FName::CompIdx) = CompIdx;
+
+		const std::wstring RawName = FName(FakeName.data()).ToRawWString();
+
+		const size_t SlashPos = RawName.rfind(L'/');
+
+		RawUtf8 = UtfN::WStringToString(RawName);
+		ValidUtf8 = MakeNameValid(SlashPos == std::wstring::npos ? std::wstring_view(RawName) : std::wstring_view(RawName).substr(SlashPos + 1));
+	}
+
+	std::unique_lock Lock(CacheMutex);
+
+	/* Another thread might have added this name in the meantime */
+	if (const Entry* CachedEntry = FindUnlocked(CompIdx))
+		return *CachedEntry;
+
+	const uint32 PageIdx = static_cast<uint32>(CompIdx) >> EntriesPerPageBits;
+
+	if (PageIdx >= Pages.size())
+		Pages.resize(PageIdx + 1);
+
+	if (!Pages[PageIdx])
+		Pages[PageIdx] = std::make_unique<Entry[]>(EntriesPerPage);
+
+	Entry& NewEntry = Pages[PageIdx][CompIdx & (EntriesPerPage - 1)];
+
+	NewEntry.Raw = DecodedIndex != -1 ? DecodedNames->GetName(DecodedIndex) : AddToArena(RawUtf8);
+
+	/* '/' is a single byte in UTF-8 as well, the short name is always the tail of the raw name */
+	const size_t Utf8SlashPos = NewEntry.Raw.rfind('/');
+	NewEntry.Short = Utf8SlashPos == std::string_view::npos ? NewEntry.Raw : NewEntry.Raw.substr(Utf8SlashPos + 1);
+
+	NewEntry.Valid = ValidUtf8 == NewEntry.Short ? NewEntry.Short : AddToArena(ValidUtf8);
+
+	return NewEntry;
+}
+
+const FNameStringCache::Entry& FNameStringCache::FindOrAdd(int32 CompIdx, uint32 Number)
+{
+	if (Number == 0x0)
+		return FindOrAdd(CompIdx);
+
+	const uint64 Key = (static_cast<uint64>(static_cast<uint32>(CompIdx)) << 32) | Number;
+
+	{
+		std::shared_lock Lock(CacheMutex);
+
+		if (auto It = NumberedEntries.find(Key); It != NumberedEntries.end())
+			return It->second;
+	}
+
+	const Entry& BaseEntry = FindOrAdd(CompIdx);
+
+	const std::string NumberSuffix = '_' + std::to_string(Number - 1);
+
+	const std::string RawUtf8 = std::string(BaseEntry.Raw) + NumberSuffix;
+
+	/* The suffix only consists of valid characters, but "bool_0" and "NULL_0" don't collide with reserved names like "bool" and "NULL" do */
+	const bool bIsReservedName = BaseEntry.Short == "bool" || BaseEntry.Short == "NULL";
+	const std::string ValidUtf8 = std::string(bIsReservedName ? BaseEntry.Short : BaseEntry.Valid) + NumberSuffix;
+
+	std::unique_lock Lock(CacheMutex);
+
+	/* Another thread might have added this name in the meantime, references to elements of an unordered_map stay valid when it grows */
+	auto [It, bInserted] = NumberedEntries.try_emplace(Key);
+
+	if (!bInserted)
+		return It->second;
+
+	Entry& NewEntry = It->second;
+
+	NewEntry.Raw = AddToArena(RawUtf8);
+	NewEntry.Short = NewEntry.Raw.substr(NewEntry.Raw.size() - (BaseEntry.Short.size() + NumberSuffix.size()));
+	NewEntry.Valid = ValidUtf8 == NewEntry.Short ? NewEntry.Short : AddToArena(ValidUtf8);
+
+	return NewEntry;
+}
+
+std::string_view FNameStringCache::Intern(const std::string& Str)
+{
+	{
+		std::shared_lock Lock(CacheMutex);
+
+		if (auto It = InternedStrings.find(Str); It != InternedStrings.end())
+			return *It;
+	}
+
+	std::unique_lock Lock(CacheMutex);
+
+	if (auto It = InternedStrings.find(Str); It != InternedStrings.end())
+		return *It;
+
+	return *InternedStrings.insert(AddToArena(Str)).first;
+}
@@ -2,6 +2,13 @@
 
 #include <array>
 #include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <iostream>
 #include <Windows.h>
 #include "Enums.h"
@@ -14,7 +21,9 @@
 
 using namespace UC;
 
-extern std::string MakeNameValid(std::wstring&& Name);
+extern std::string MakeNameValid(std::wstring_view Name);
+
+struct DecodedNameTable;
 
 /*
 template<typename ValueType, typename KeyType>
@@ -207,8 +216,84 @@ private:
 };
 
 
+/*
+* Per-run cache of FName strings, indexed by the ComparisonIndex.
+* 
+* Strings are resolved once per ComparisonIndex, without the number-suffix, and stored in an append-only arena. Entries are
+* never modified after they were added. Arenas are never freed, Init() retires the previous ones, so views stay valid after a re-init.
+*/
+class FNameStringCache
+{
+public:
+	struct Entry
+	{
+		/* Full name, eg. "/Script/CoreUObject" */
+		std::string_view Raw;
+
+		/* Name after the last '/', eg. "CoreUObject" */
+		std::string_view Short;
+
+		/* Short name made a valid C++ identifier */
+		std::string_view Valid;
+	};
+
+private:
+	/* ComparisonIndices of the FNamePool are [Block | Offset], pages keep the table dense without allocating entries for unused blocks */
+	static constexpr int32 EntriesPerPageBits = 16;
+	static constexpr int32 EntriesPerPage = 1 << EntriesPerPageBits;
+
+	static constexpr int32 ArenaBlockSize = 0x100000;
+
+private:
+	static inline std::vector<std::unique_ptr<Entry[]>> Pages;
+
+	/* Names with a Number, keyed by [ComparisonIndex | Number]. Much less common than names without one, so they're not stored densely. */
+	static inline std::unordered_map<uint64, Entry> NumberedEntries;
+
+	/* Strings resolved while the cache is disabled, deduplicated so repeated lookups of a name don't grow the arena */
+	static inline std::unordered_set<std::string_view> InternedStrings;
+
+	static inline std::vector<std::unique_ptr<char[]>> ArenaBlocks;
+	static inline int32 CurrentArenaBlockOffset = ArenaBlockSize;
+
+	/* Arenas, and decoded tables, of previous Init() calls. Views into them could have been handed out, eg. before a rejected offset-cache. */
+	static inline std::vector<std::unique_ptr<char[]>> RetiredArenaBlocks;
+	static std::vector<std::unique_ptr<DecodedNameTable>> RetiredDecodedNames;
+
+	/* Names are resolved from the package-generation threads */
+	static inline std::shared_mutex CacheMutex;
+
+	static inline bool bIsEnabled = false;
+
+	/* All names of GNames, decoded in bulk on Init(). Cached entries point into this table instead of copying the names into the arena. */
+	static std::unique_ptr<DecodedNameTable> DecodedNames;
+	static inline bool bHasDecodedNames = false;
+
+private:
+	static std::string_view AddToArena(const std::string& Str);
+
+	static const Entry* FindUnlocked(int32 CompIdx);
+
+public:
+	/* Clears the cache and enables it. Must be called after Off::Init(), as the FName layout is required to resolve names. Decodes all names if FName uses GNames. */
+	static void Init();
+
+	static inline bool IsEnabled() { return bIsEnabled; }
+
+	static const Entry& FindOrAdd(int32 CompIdx);
+
+	/* Entry of a name with a Number, all forms already contain the "_{Number - 1}" suffix */
+	static const Entry& FindOrAdd(int32 CompIdx, uint32 Number);
+
+	/* Copies 'Str' into the arena once, used for names that can't be cached by their ComparisonIndex */
+	static std::string_view Intern(const std::string& Str);
+};
+
 class FName
 {
+private:
+	friend class OffsetCache;
+
 public:
 	enum class EOffsetOverrideType
 	{
@@ -242,10 +327,16 @@ public:
 	std::wstring ToWString() const;
 	std::wstring ToRawWString() const;
 
+public:
 	std::string ToString() const;
 	std::string ToRawString() const;
 	std::string ToValidString() const;
 
+	/* Views into the FNameStringCache, they stay valid until the process exits */
+	std::string_view ToStringView() const;
+	std::string_view ToRawStringView() const;
+	std::string_view ToValidStringView() const;
+
 	int32 GetCompIdx() const;
 	uint32 GetNumber() const;
 
@@ -5,6 +5,12 @@
 #include <string>
 #include <algorithm>
 #include <functional>
+#include <chrono>
+#include <mutex>
+#include <shared_mutex>
+
+#include "PatternScanner.h"
+#include "MemoryRegionMap.h"
 
 /* Credits: https://en.cppreference.com/w/cpp/string/byte/tolower */
 inline std::string str_tolower(std::string S)
@@ -307,22 +313,148 @@ inline bool IsInProcessRange(const void* Address)
 {
 	return IsInProcessRange(reinterpret_cast<const uintptr_t>(Address));
 }
-inline bool IsBadReadPtr(const void* Ptr)
+inline bool IsReadablePageProtection(DWORD Protect)
 {
-	if(!IsValidVirtualAddress(reinterpret_cast<const uintptr_t>(Ptr)))
-		return true;
+	constexpr DWORD AccessibleMask = (PAGE_READONLY | PAGE_READWRITE | PAGE_WRITECOPY | PAGE_EXECUTE_READ | PAGE_EXECUTE_READWRITE | PAGE_EXECUTE_WRITECOPY);
+	constexpr DWORD InaccessibleMask = (PAGE_GUARD | PAGE_NOACCESS);
+
+	return (Protect & AccessibleMask) && !(Protect & InaccessibleMask);
+}
+
+class WindowsMemoryRegionSource : public MemoryRegionSource
+{
+public:
+	inline bool QueryReadableRegions(std::vector<MemoryRegion>& OutRegions) const override
+	{
+		SYSTEM_INFO SystemInfo;
+		GetSystemInfo(&SystemInfo);
+
+		uintptr_t CurrentAddress = reinterpret_cast<uintptr_t>(SystemInfo.lpMinimumApplicationAddress);
+		const uintptr_t MaxAddress = reinterpret_cast<uintptr_t>(SystemInfo.lpMaximumApplicationAddress);
+
+		MEMORY_BASIC_INFORMATION Mbi;
+
+		/* One query per region, not per page */
+		while (CurrentAddress < MaxAddress && VirtualQuery(reinterpret_cast<void*>(CurrentAddress), &Mbi, sizeof(Mbi)))
+		{
+			const uintptr_t RegionStart = reinterpret_cast<uintptr_t>(Mbi.BaseAddress);
+			const uintptr_t RegionEnd = RegionStart + Mbi.RegionSize;
+
+			if (Mbi.State == MEM_COMMIT && IsReadablePageProtection(Mbi.Protect))
+				OutRegions.push_back({ RegionStart, RegionEnd });
+
+			if (RegionEnd <= CurrentAddress)
+				break;
 
-	MEMORY_BASIC_INFORMATION Mbi;
+			CurrentAddress = RegionEnd;
+		}
+
+		return !OutRegions.empty();
+	}
+};
+
+/*
+* Snapshot of the readable memory used by IsBadReadPtr, instead of calling VirtualQuery for every pointer.
+* 
+* Answers, readable or not, only come from a snapshot younger than 'MaxSnapshotAge'. Memory freed or allocated afterwards is
+* noticed once the snapshot expired and is retaken, by the first thread asking for it. Threads asking at the same time wait for
+* that refresh and use its result, instead of walking the address space themselves.
+*/
+class ReadableRegionCache
+{
+private:
+	static constexpr std::chrono::milliseconds MaxSnapshotAge = std::chrono::milliseconds(250);
+
+private:
+	static inline std::shared_mutex MapMutex;
+	static inline MemoryRegionMap Map;
 
-	if (VirtualQuery(Ptr, &Mbi, sizeof(Mbi)))
+	/* Whether the last refresh succeeded, if not pointers are queried directly until the next refresh */
+	static inline bool bIsMapValid = false;
+	static inline std::chrono::steady_clock::time_point LastRefreshTime;
+
+	/* Incremented by every refresh, only modified while both mutexes are held */
+	static inline uint64_t Generation = 0x0;
+
+	/* Only one thread refreshes at a time */
+	static inline std::mutex RefreshMutex;
+
+private:
+	static inline bool IsReadableByQuery(uintptr_t Address)
 	{
-		constexpr DWORD AccessibleMask = (PAGE_READONLY | PAGE_READWRITE | PAGE_WRITECOPY | PAGE_EXECUTE_READ | PAGE_EXECUTE_READWRITE | PAGE_EXECUTE_WRITECOPY);
-		constexpr DWORD InaccessibleMask = (PAGE_GUARD | PAGE_NOACCESS);
+		MEMORY_BASIC_INFORMATION Mbi;
 
-		return !(Mbi.Protect & AccessibleMask) || (Mbi.Protect & InaccessibleMask);
+		return VirtualQuery(reinterpret_cast<void*>(Address), &Mbi, sizeof(Mbi)) && Mbi.State == MEM_COMMIT && IsReadablePageProtection(Mbi.Protect);
 	}
 
-	return true;
+	/* Takes a new snapshot, unless another thread did so since 'SeenGeneration' was read */
+	static inline void RefreshIfUnchanged(uint64_t SeenGeneration)
+	{
+		std::scoped_lock RefreshLock(RefreshMutex);
+
+		/* Generation isn't modified without the RefreshMutex, reading it doesn't need the MapMutex */
+		if (Generation != SeenGeneration)
+			return;
+
+		MemoryRegionMap NewMap;
+		const bool bRefreshed = NewMap.Refresh(WindowsMemoryRegionSource());
+
+		std::unique_lock Lock(MapMutex);
+
+		if (bRefreshed)
+			Map = std::move(NewMap);
+
+		bIsMapValid = bRefreshed;
+		LastRefreshTime = std::chrono::steady_clock::now();
+		Generation++;
+	}
+
+	/* Requires MapMutex to be held */
+	static inline bool IsReadableUnlocked(uintptr_t Address)
+	{
+		return bIsMapValid ? Map.IsReadable(Address) : IsReadableByQuery(Address);
+	}
+
+public:
+	static inline bool Refresh()
+	{
+		uint64_t SeenGeneration;
+		{
+			std::shared_lock Lock(MapMutex);
+			SeenGeneration = Generation;
+		}
+
+		RefreshIfUnchanged(SeenGeneration);
+
+		std::shared_lock Lock(MapMutex);
+		return bIsMapValid;
+	}
+
+	static inline bool IsReadable(uintptr_t Address)
+	{
+		uint64_t SeenGeneration;
+		{
+			std::shared_lock Lock(MapMutex);
+
+			if (Generation != 0x0 && (std::chrono::steady_clock::now() - LastRefreshTime) < MaxSnapshotAge)
+				return IsReadableUnlocked(Address);
+
+			SeenGeneration = Generation;
+		}
+
+		RefreshIfUnchanged(SeenGeneration);
+
+		std::shared_lock Lock(MapMutex);
+		return IsReadableUnlocked(Address);
+	}
+};
+
+inline bool IsBadReadPtr(const void* Ptr)
+{
+	if(!IsValidVirtualAddress(reinterpret_cast<const uintptr_t>(Ptr)))
+		return true;
+
+	return !ReadableRegionCache::IsReadable(reinterpret_cast<const uintptr_t>(Ptr));
 };
 
 inline bool IsBadReadPtr(const uintptr_t Ptr)
@@ -483,69 +615,37 @@ inline void* GetExportAddress(const char* SearchModuleName, const char* SearchFu
 	return nullptr;
 }
 
-inline void* FindPatternInRange(std::vector<int>&& Signature, const uint8_t* Start, uintptr_t Range, bool bRelative = false, uint32_t Offset = 0, int SkipCount = 0)
+inline void* FindPatternInRange(const BytePattern& Pattern, const uint8_t* Start, uintptr_t Range, bool bRelative = false, uint32_t Offset = 0, int SkipCount = 0)
 {
-	const auto PatternLength = Signature.size();
-	const auto PatternBytes = Signature.data();
+	const auto PatternLength = Pattern.Size();
 
-	for (int i = 0; i < (Range - PatternLength); i++)
-	{
-		bool bFound = true;
-		int CurrentSkips = 0;
+	if (Range <= PatternLength)
+		return nullptr;
 
-		for (auto j = 0ul; j < PatternLength; ++j)
-		{
-			if (Start[i + j] != PatternBytes[j] && PatternBytes[j] != -1)
-			{
-				bFound = false;
-				break;
-			}
-		}
-		if (bFound)
-		{
-			if (CurrentSkips != SkipCount)
-			{
-				CurrentSkips++;
-				continue;
-			}
+	const uint8_t* Match = PatternScanUtils::FindFirst(Pattern, Start, Range - PatternLength, SkipCount);
 
-			uintptr_t Address = uintptr_t(Start + i);
-			if (bRelative)
-			{
-				if (Offset == -1)
-					Offset = PatternLength;
+	if (!Match)
+		return nullptr;
 
-				Address = ((Address + Offset + 4) + *reinterpret_cast<int32_t*>(Address + Offset));
-			}
-			return reinterpret_cast<void*>(Address);
-		}
+	uintptr_t Address = uintptr_t(Match);
+	if (bRelative)
+	{
+		if (Offset == -1)
+			Offset = PatternLength;
+
+		Address = ((Address + Offset + 4) + *reinterpret_cast<int32_t*>(Address + Offset));
 	}
+	return reinterpret_cast<void*>(Address);
+}
 
-	return nullptr;
+inline void* FindPatternInRange(std::vector<int>&& Signature, const uint8_t* Start, uintptr_t Range, bool bRelative = false, uint32_t Offset = 0, int SkipCount = 0)
+{
+	return FindPatternInRange(BytePattern(Signature), Start, Range, bRelative, Offset, SkipCount);
 }
 
 inline void* FindPatternInRange(const char* Signature, const uint8_t* Start, uintptr_t Range, bool bRelative = false, uint32_t Offset = 0)
 {
-	static auto patternToByte = [](const char* pattern) -> std::vector<int>
-	{
-		auto Bytes = std::vector<int>{};
-		const auto Start = const_cast<char*>(pattern);
-		const auto End = const_cast<char*>(pattern) + strlen(pattern);
-
-		for (auto Current = Start; Current < End; ++Current)
-		{
-			if (*Current == '?')
-			{
-				++Current;
-				if (*Current == '?') ++Current;
-				Bytes.push_back(-1);
-			}
-			else { Bytes.push_back(strtoul(Current, &Current, 16)); }
-		}
-		return Bytes;
-	};
-
-	return FindPatternInRange(patternToByte(Signature), Start, Range, bRelative, Offset);
+	return FindPatternInRange(BytePattern(Signature), Start, Range, bRelative, Offset);
 }
 
 inline void* FindPattern(const char* Signature, uint32_t Offset = 0, bool bSearchAllSections = false, uintptr_t StartAddress = 0x0)
@@ -942,22 +1042,61 @@ inline MemAddress FindByWString(const wchar_t* RefStr)
 	return FindByString<const wchar_t*>(RefStr);
 }
 
-/* Slower than FindByString */
+/*
+* Adds a pattern matching RIP-relative lea instructions ("48 8D" or "4C 8D") which load 'RefStr' to the scanner.
+* 
+* Multiple strings can be searched for with a single ScanForStringRefsInAllSections() call. 'RefStr' needs to stay valid until the scan is done.
+*/
 template<bool bCheckIfLeaIsStrPtr = false, typename CharType = char>
-inline MemAddress FindByStringInAllSections(const CharType* RefStr, uintptr_t StartAddress = 0x0, int32_t Range = 0x0)
+inline int32_t AddStringRefPattern(MultiPatternScanner& Scanner, const CharType* RefStr)
 {
-	static_assert(std::is_same_v<CharType, char> || std::is_same_v<CharType, wchar_t>, "FindByStringInAllSections only supports 'char' and 'wchar_t', but was called with other type.");
+	static_assert(std::is_same_v<CharType, char> || std::is_same_v<CharType, wchar_t>, "AddStringRefPattern only supports 'char' and 'wchar_t', but was called with other type.");
+
+	/* REX.W (+ REX.R), lea, ModRM with mod == 00 and r/m == 101 for [rip + disp32] */
+	static const BytePattern RelativeLeaPattern({ 0x48, 0x8D, 0x05, 0x00, 0x00, 0x00, 0x00 }, { 0xFB, 0xFF, 0xC7, 0x00, 0x00, 0x00, 0x00 });
+
+	const int32_t RefStrLen = StrlenHelper(RefStr);
+
+	return Scanner.AddPattern(RelativeLeaPattern, [RefStr, RefStrLen](const uint8_t* Match) -> bool
+	{
+		const uintptr_t StrPtr = ASMUtils::Resolve32BitRelativeLea(reinterpret_cast<uintptr_t>(Match));
 
+		if (!IsInProcessRange(StrPtr))
+			return false;
+
+		if (StrnCmpHelper(RefStr, reinterpret_cast<const CharType*>(StrPtr), RefStrLen))
+			return true;
+
+		if constexpr (bCheckIfLeaIsStrPtr)
+		{
+			const CharType* StrPtrContentFirst8Bytes = *reinterpret_cast<const CharType* const*>(StrPtr);
+
+			if (!IsInProcessRange(StrPtrContentFirst8Bytes))
+				return false;
+
+			return StrnCmpHelper(RefStr, StrPtrContentFirst8Bytes, RefStrLen);
+		}
+
+		return false;
+	});
+}
+
+/* Scans the image, or 'Range' bytes after 'StartAddress', for all string-refs added with AddStringRefPattern() in a single pass */
+inline void ScanForStringRefsInAllSections(MultiPatternScanner& Scanner, uintptr_t StartAddress = 0x0, int32_t Range = 0x0)
+{
 	/* Stop scanning when arriving 0x10 bytes before the end of the memory range */
 	constexpr int32_t OffsetFromMemoryEnd = 0x10;
 
+	/* Size of 'lea reg, [rip + disp32]' */
+	constexpr int32_t LeaInstructionSize = 0x7;
+
 	const auto [ImageBase, ImageSize] = GetImageBaseAndSize();
 
 	const uintptr_t ImageEnd = ImageBase + ImageSize;
 
 	/* If the StartAddress is not default nullptr, and is out of memory-range */
 	if (StartAddress != 0x0 && (StartAddress < ImageBase || StartAddress > ImageEnd))
-		return nullptr;
+		return;
 
 	/* Add a few bytes to the StartAddress to prevent instantly returning the previous result */
 	uint8_t* SearchStart = StartAddress ? (reinterpret_cast<uint8_t*>(StartAddress) + 0x5) : reinterpret_cast<uint8_t*>(ImageBase);
@@ -969,35 +1108,23 @@ inline MemAddress FindByStringInAllSections(const CharType* RefStr, uintptr_t St
 	if ((StartAddress + SearchRange) >= ImageEnd)
 		SearchRange -= OffsetFromMemoryEnd;
 
-	const int32_t RefStrLen = StrlenHelper(RefStr);
-
-	for (uintptr_t i = 0; i < SearchRange; i++)
-	{
-		// opcode: lea
-		if ((SearchStart[i] == uint8_t(0x4C) || SearchStart[i] == uint8_t(0x48)) && SearchStart[i + 1] == uint8_t(0x8D))
-		{
-			const uintptr_t StrPtr = ASMUtils::Resolve32BitRelativeLea(reinterpret_cast<uintptr_t>(SearchStart + i));
-
-			if (!IsInProcessRange(StrPtr))
-				continue;
+	/* Instructions starting at any of the 'SearchRange' positions are checked, as before */
+	Scanner.Scan(SearchStart, SearchRange + (LeaInstructionSize - 1));
+}
 
-			if (StrnCmpHelper(RefStr, reinterpret_cast<const CharType*>(StrPtr), RefStrLen))
-				return { SearchStart + i };
+/* Slower than FindByString, use AddStringRefPattern() with ScanForStringRefsInAllSections() to search for multiple strings at once */
+template<bool bCheckIfLeaIsStrPtr = false, typename CharType = char>
+inline MemAddress FindByStringInAllSections(const CharType* RefStr, uintptr_t StartAddress = 0x0, int32_t Range = 0x0)
+{
+	static_assert(std::is_same_v<CharType, char> || std::is_same_v<CharType, wchar_t>, "FindByStringInAllSections only supports 'char' and 'wchar_t', but was called with other type.");
 
-			if constexpr (bCheckIfLeaIsStrPtr)
-			{
-				const CharType* StrPtrContentFirst8Bytes = *reinterpret_cast<const CharType* const*>(StrPtr);
+	MultiPatternScanner Scanner;
 
-				if (!IsInProcessRange(StrPtrContentFirst8Bytes))
-					continue;
+	const int32_t RefIndex = AddStringRefPattern<bCheckIfLeaIsStrPtr>(Scanner, RefStr);
 
-				if (StrnCmpHelper(RefStr, StrPtrContentFirst8Bytes, RefStrLen))
-					return { SearchStart + i };
-			}
-		}
-	}
+	ScanForStringRefsInAllSections(Scanner, StartAddress, Range);
 
-	return nullptr;
+	return const_cast<uint8_t*>(Scanner.GetResult(RefIndex));
 }
 
 template<typename Type = const char*>
@@ -57,10 +57,10 @@ DWORD MainThread(HMODULE Module)
 	std::cout << "GameName: " << Settings::Generator::GameName << "\n";
 	std::cout << "GameVersion: " << Settings::Generator::GameVersion << "\n\n";
 
-	Generator::Generate<CppGenerator>();
-	Generator::Generate<MappingGenerator>();
-	Generator::Generate<IDAMappingGenerator>();
-	Generator::Generate<DumpspaceGenerator>();
+	Generator::GenerateAll<CppGenerator, MappingGenerator, IDAMappingGenerator, DumpspaceGenerator>();
+
+	if constexpr (Settings::Generator::bGenerateReflectionSnapshot)
+		Generator::GenerateReflectionSnapshot();
 
 
 	auto t_C = std::chrono::high_resolution_clock::now();